@@ -1416,6 +1416,13 @@ use File::Glob qw(:case);
 	'UPSTREAM'	=> 'blead',
 	},
 
+    'Thread::WorkerPool' =>
+	{
+	'MAINTAINER'	=> 'p5p',
+	'FILES'		=> q[dist/Thread-WorkerPool],
+	'UPSTREAM'	=> 'blead',
+	},
+
     'threads' =>
 	{
 	'MAINTAINER'	=> 'jdhedden',
@@ -1622,6 +1629,7 @@ use File::Glob qw(:case);
 	{
 	'MAINTAINER'	=> 'p5p',
 	'FILES'		=> q[
+				ext/Array-Dense/
 				ext/autouse/lib
 				ext/autouse/t
 				ext/B/B.pm
@@ -1671,6 +1679,7 @@ use File::Glob qw(:case);
 				ext/Hash-Util-FieldHash/
 				ext/Hash-Util/
 				ext/I18N-Langinfo/
+				ext/IO-EventPoll/
 				ext/IPC-Open2/
 				ext/IPC-Open3/
 				ext/NDBM_File/
@@ -1815,6 +1824,7 @@ use File::Glob qw(:case);
 				lib/strict.{pm,t}
 				lib/subs.{pm,t}
 				lib/syslog.pl
+				lib/tailcall.{pm,t}
 				lib/tainted.pl
 				lib/termcap.pl
 				lib/timelocal.pl
@@ -23,6 +23,16 @@
 #define PERL_IN_AV_C
 #include "perl.h"
 
+/* An array that runs out of room grows by at least this fraction of its
+ * size, and by at least PERL_ARRAY_GROWTH_MIN elements.  A smaller
+ * divisor means fewer reallocations when an array is built up an element
+ * at a time, and more unused space at the end of it.  av_shrink() gives
+ * the unused space back. */
+#ifndef PERL_ARRAY_GROWTH_DIVISOR
+#  define PERL_ARRAY_GROWTH_DIVISOR 2
+#endif
+#define PERL_ARRAY_GROWTH_MIN 4
+
 void
 Perl_av_reify(pTHX_ AV *av)
 {
@@ -107,11 +117,8 @@ Perl_av_extend(pTHX_ AV *av, I32 key)
 #endif
 
 	    if (AvALLOC(av)) {
-#if !defined(STRANGE_MALLOC) && !defined(MYMALLOC)
-		MEM_SIZE bytes;
-		IV itmp;
-#endif
-
+		I32 step;
+		I32 grown;
 #ifdef Perl_safesysmalloc_size
 		/* Whilst it would be quite possible to move this logic around
 		   (as I did in the SV code), so as to set AvMAX(av) early,
@@ -132,31 +139,20 @@ Perl_av_extend(pTHX_ AV *av, I32 key)
 		if (key <= newmax) 
 		    goto resized;
 #endif 
-		newmax = key + AvMAX(av) / 5;
+		/* Grow geometrically, so that storing elements one at a
+		   time takes linear time overall, but give a caller that
+		   asks for more than that exactly what it asked for, so
+		   that presizing for a known count wastes nothing. */
+		step = AvMAX(av) / PERL_ARRAY_GROWTH_DIVISOR;
+		if (step < PERL_ARRAY_GROWTH_MIN)
+		    step = PERL_ARRAY_GROWTH_MIN;
+		grown = AvMAX(av) <= (I32_MAX - 1) - step
+		    ? AvMAX(av) + step
+		    : I32_MAX - 1;
+		newmax = key > grown ? key : grown;
 	      resize:
 		MEM_WRAP_CHECK_1(newmax+1, SV*, oom_array_extend);
-#if defined(STRANGE_MALLOC) || defined(MYMALLOC)
 		Renew(AvALLOC(av),newmax+1, SV*);
-#else
-		bytes = (newmax + 1) * sizeof(const SV *);
-#define MALLOC_OVERHEAD 16
-		itmp = MALLOC_OVERHEAD;
-		while ((MEM_SIZE)(itmp - MALLOC_OVERHEAD) < bytes)
-		    itmp += itmp;
-		itmp -= MALLOC_OVERHEAD;
-		itmp /= sizeof(const SV *);
-		assert(itmp > newmax);
-		newmax = itmp - 1;
-		assert(newmax >= AvMAX(av));
-		Newx(ary, newmax+1, SV*);
-		Copy(AvALLOC(av), ary, AvMAX(av)+1, SV*);
-		if (AvMAX(av) > 64)
-		    offer_nice_chunk(AvALLOC(av),
-				     (AvMAX(av)+1) * sizeof(const SV *));
-		else
-		    Safefree(AvALLOC(av));
-		AvALLOC(av) = ary;
-#endif
 #ifdef Perl_safesysmalloc_size
 	      resized:
 #endif
@@ -187,6 +183,47 @@ Perl_av_extend(pTHX_ AV *av, I32 key)
     }
 }
 
+/*
+=for apidoc av_shrink
+
+Frees the space that an array has allocated beyond its last element, as
+left by growing it or by removing elements from either end.  Arrays
+keep that space for reuse, so this is only worth calling for a large
+array that is not going to grow again.  Does nothing for tied arrays.
+
+=cut
+*/
+
+void
+Perl_av_shrink(pTHX_ AV *av)
+{
+    dVAR;
+    const I32 fill = AvFILLp(av);
+
+    PERL_ARGS_ASSERT_AV_SHRINK;
+    assert(SvTYPE(av) == SVt_PVAV);
+
+    if (SvTIED_mg((const SV *)av, PERL_MAGIC_tied) || !AvALLOC(av)
+	|| av == PL_curstack)
+	return;
+    if (AvALLOC(av) != AvARRAY(av)) {
+	Move(AvARRAY(av), AvALLOC(av), fill+1, SV*);
+	AvMAX(av) += AvARRAY(av) - AvALLOC(av);
+	AvARRAY(av) = AvALLOC(av);
+    }
+    if (fill < 0) {
+	Safefree(AvALLOC(av));
+	AvALLOC(av) = NULL;
+	AvARRAY(av) = NULL;
+	AvMAX(av) = -1;
+    }
+    else if (fill < AvMAX(av)) {
+	Renew(AvALLOC(av), fill+1, SV*);
+	AvARRAY(av) = AvALLOC(av);
+	AvMAX(av) = fill;
+    }
+}
+
 /*
 =for apidoc av_fetch
 
@@ -23,7 +23,7 @@ use B qw(class main_root main_start main_cv svref_2object opnumber perlstring
 	 PMf_MULTILINE PMf_SINGLELINE PMf_FOLD PMf_EXTENDED),
 	 ($] < 5.009 ? 'PMf_SKIPWHITE' : 'RXf_SKIPWHITE'),
 	 ($] < 5.011 ? 'CVf_LOCKED' : ());
-$VERSION = 0.97;
+$VERSION = 0.98;
 use strict;
 use vars qw/$AUTOLOAD/;
 use warnings ();
@@ -2641,6 +2641,13 @@ sub pp_once {
     return $self->deparse($true, $cx);
 }
 
+sub pp_inlinesub {
+    my ($self, $op, $cx) = @_;
+    my $call = $op->first->sibling->sibling;
+
+    return $self->deparse($call, $cx);
+}
+
 sub loop_common {
     my $self = shift;
     my($op, $cx, $init) = @_;
@@ -17,12 +17,43 @@ static I32 esc_q (char *dest, const char *src, STRLEN slen);
 static I32 esc_q_utf8 (pTHX_ SV *sv, const char *src, STRLEN slen);
 static I32 needs_quote(register const char *s);
 static SV *sv_x (pTHX_ SV *sv, const char *str, STRLEN len, I32 n);
+
+/* The configuration of one Dumpxs() call.  It is read from the object
+ * once, and the settings that are off are left NULL so that DD_dump()
+ * can skip them without looking at the SVs again.
+ */
+typedef struct {
+    I32 indent;
+    I32 purity;
+    I32 deepcopy;
+    I32 quotekeys;
+    I32 maxdepth;
+    SV *pad;
+    SV *xpad;
+    SV *sep;
+    SV *pair;
+    SV *freezer;	/* NULL unless set to a method name */
+    SV *toaster;	/* NULL unless set to a method name */
+    SV *bless;
+    SV *sortkeys;	/* NULL, &PL_sv_yes or a CODE ref */
+    AV *xpads;		/* xpad repeated n times, built on demand */
+} Style;
+
 static I32 DD_dump (pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval,
-		    HV *seenhv, AV *postav, I32 *levelp, I32 indent,
-		    SV *pad, SV *xpad, SV *apad, SV *sep, SV *pair,
-		    SV *freezer, SV *toaster,
-		    I32 purity, I32 deepcopy, I32 quotekeys, SV *bless,
-		    I32 maxdepth, SV *sortkeys);
+		    HV *seenhv, AV *postav, I32 *levelp, SV *apad,
+		    const Style *style);
+
+/* The output buffer kept between calls to Dumpxs() */
+#define MY_CXT_KEY "Data::Dumper::_guts" XS_VERSION
+
+typedef struct {
+    SV *buf;
+} my_cxt_t;
+
+START_MY_CXT
+
+#define DD_BUF_INIT	256
+#define DD_BUF_KEEP	65536	/* don't hold on to anything larger */
 
 #ifndef HvNAME_get
 #define HvNAME_get HvNAME
@@ -253,6 +284,35 @@ sv_x(pTHX_ SV *sv, const char *str, STRLEN len, I32 n)
     return sv;
 }
 
+/* xpad repeated n times, kept for every container at that depth */
+static SV *
+level_pad(pTHX_ const Style *style, I32 n)
+{
+    SV ** const svp = av_fetch(style->xpads, n, TRUE);
+
+    if (!SvPOK(*svp)) {
+	sv_setpvn(*svp, "", 0);
+	(void)sv_x(aTHX_ *svp, SvPVX_const(style->xpad), SvCUR(style->xpad), n);
+    }
+    return *svp;
+}
+
+#if PERL_VERSION >= 8
+/* sv_cmp() for two plain byte strings, without its checks for UTF-8,
+ * magic and locale.  Sortkeys = 1 uses it when every key is one.
+ */
+static I32
+key_cmp(pTHX_ SV *const a, SV *const b)
+{
+    const STRLEN la = SvCUR(a);
+    const STRLEN lb = SvCUR(b);
+    const int cmp = memcmp(SvPVX_const(a), SvPVX_const(b), la < lb ? la : lb);
+
+    PERL_UNUSED_CONTEXT;
+    return cmp ? (cmp < 0 ? -1 : 1) : la < lb ? -1 : la > lb;
+}
+#endif
+
 /*
  * This ought to be split into smaller functions. (it is one long function since
  * it exactly parallels the perl version, which was one long thing for
@@ -260,9 +320,7 @@ sv_x(pTHX_ SV *sv, const char *str, STRLEN len, I32 n)
  */
 static I32
 DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
-	AV *postav, I32 *levelp, I32 indent, SV *pad, SV *xpad,
-	SV *apad, SV *sep, SV *pair, SV *freezer, SV *toaster, I32 purity,
-	I32 deepcopy, I32 quotekeys, SV *bless, I32 maxdepth, SV *sortkeys)
+	AV *postav, I32 *levelp, SV *apad, const Style *style)
 {
     char tmpbuf[128];
     U32 i;
@@ -305,14 +363,13 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 
         /* If a freeze method is provided and the object has it, call
            it.  Warn on errors. */
-	if (SvOBJECT(SvRV(val)) && freezer &&
-	    SvPOK(freezer) && SvCUR(freezer) &&
-            gv_fetchmeth(SvSTASH(SvRV(val)), SvPVX_const(freezer), 
-                         SvCUR(freezer), -1) != NULL)
+	if (style->freezer && SvOBJECT(SvRV(val)) &&
+            gv_fetchmeth(SvSTASH(SvRV(val)), SvPVX_const(style->freezer),
+                         SvCUR(style->freezer), -1) != NULL)
 	{
 	    dSP; ENTER; SAVETMPS; PUSHMARK(sp);
 	    XPUSHs(val); PUTBACK;
-	    i = perl_call_method(SvPVX_const(freezer), G_EVAL|G_VOID);
+	    i = perl_call_method(SvPVX_const(style->freezer), G_EVAL|G_VOID);
 	    SPAGAIN;
 	    if (SvTRUE(ERRSV))
 		warn("WARNING(Freezer method call failed): %"SVf"", ERRSV);
@@ -343,7 +400,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		if ((svp = av_fetch(seenentry, 0, FALSE))
 		    && (othername = *svp))
 		{
-		    if (purity && *levelp > 0) {
+		    if (style->purity && *levelp > 0) {
 			SV *postentry;
 			
 			if (realtype == SVt_PVHV)
@@ -430,7 +487,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	 * representation of the thing we are currently examining
 	 * at this depth (i.e., 'Foo=ARRAY(0xdeadbeef)').
 	 */
-	if (!purity && maxdepth > 0 && *levelp >= maxdepth) {
+	if (!style->purity && style->maxdepth > 0 && *levelp >= style->maxdepth) {
 	    STRLEN vallen;
 	    const char * const valstr = SvPV(val,vallen);
 	    sv_catpvn(retval, "'", 1);
@@ -441,10 +498,10 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 
 	if (realpack && !no_bless) {				/* we have a blessed ref */
 	    STRLEN blesslen;
-	    const char * const blessstr = SvPV(bless, blesslen);
+	    const char * const blessstr = SvPV(style->bless, blesslen);
 	    sv_catpvn(retval, blessstr, blesslen);
 	    sv_catpvn(retval, "( ", 2);
-	    if (indent >= 2) {
+	    if (style->indent >= 2) {
 		blesspad = apad;
 		apad = newSVsv(apad);
 		sv_x(aTHX_ apad, " ", 1, blesslen+2);
@@ -452,7 +509,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	}
 
 	(*levelp)++;
-	ipad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), *levelp);
+	ipad = level_pad(aTHX_ style, *levelp);
 
         if (is_regex) 
         {
@@ -483,17 +540,13 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    if (realpack) {				     /* blessed */
 		sv_catpvn(retval, "do{\\(my $o = ", 13);
 		DD_dump(aTHX_ ival, SvPVX_const(namesv), SvCUR(namesv), retval, seenhv,
-			postav, levelp,	indent, pad, xpad, apad, sep, pair,
-			freezer, toaster, purity, deepcopy, quotekeys, bless,
-			maxdepth, sortkeys);
+			postav, levelp, apad, style);
 		sv_catpvn(retval, ")}", 2);
 	    }						     /* plain */
 	    else {
 		sv_catpvn(retval, "\\", 1);
 		DD_dump(aTHX_ ival, SvPVX_const(namesv), SvCUR(namesv), retval, seenhv,
-			postav, levelp,	indent, pad, xpad, apad, sep, pair,
-			freezer, toaster, purity, deepcopy, quotekeys, bless,
-			maxdepth, sortkeys);
+			postav, levelp, apad, style);
 	    }
 	    SvREFCNT_dec(namesv);
 	}
@@ -503,9 +556,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    sv_catpvn(namesv, "}", 1);
 	    sv_catpvn(retval, "\\", 1);
 	    DD_dump(aTHX_ ival, SvPVX_const(namesv), SvCUR(namesv), retval, seenhv,
-		    postav, levelp,	indent, pad, xpad, apad, sep, pair,
-		    freezer, toaster, purity, deepcopy, quotekeys, bless,
-		    maxdepth, sortkeys);
+			postav, levelp, apad, style);
 	    SvREFCNT_dec(namesv);
 	}
 	else if (realtype == SVt_PVAV) {
@@ -513,7 +564,6 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    I32 ix = 0;
 	    const I32 ixmax = av_len((AV *)ival);
 	
-	    SV * const ixsv = newSViv(0);
 	    /* allowing for a 24 char wide array index */
 	    New(0, iname, namelen+28, char);
 	    (void)strcpy(iname, name);
@@ -545,8 +595,8 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		iname[inamelen++] = '-'; iname[inamelen++] = '>';
 	    }
 	    iname[inamelen++] = '['; iname[inamelen] = '\0';
-	    totpad = newSVsv(sep);
-	    sv_catsv(totpad, pad);
+	    totpad = newSVsv(style->sep);
+	    sv_catsv(totpad, style->pad);
 	    sv_catsv(totpad, apad);
 
 	    for (ix = 0; ix <= ixmax; ++ix) {
@@ -559,7 +609,6 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		    elem = &PL_sv_undef;
 		
 		ilen = inamelen;
-		sv_setiv(ixsv, ix);
 #if PERL_VERSION < 10
                 (void) sprintf(iname+ilen, "%"IVdf, (IV)ix);
 		ilen = strlen(iname);
@@ -567,44 +616,42 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                 ilen = ilen + my_sprintf(iname+ilen, "%"IVdf, (IV)ix);
 #endif
 		iname[ilen++] = ']'; iname[ilen] = '\0';
-		if (indent >= 3) {
+		if (style->indent >= 3) {
 		    sv_catsv(retval, totpad);
 		    sv_catsv(retval, ipad);
 		    sv_catpvn(retval, "#", 1);
-		    sv_catsv(retval, ixsv);
+		    /* the index just formatted into iname */
+		    sv_catpvn(retval, iname+inamelen, ilen-inamelen-1);
 		}
 		sv_catsv(retval, totpad);
 		sv_catsv(retval, ipad);
-		DD_dump(aTHX_ elem, iname, ilen, retval, seenhv, postav,
-			levelp,	indent, pad, xpad, apad, sep, pair,
-			freezer, toaster, purity, deepcopy, quotekeys, bless,
-			maxdepth, sortkeys);
+		DD_dump(aTHX_ elem, iname, ilen, retval, seenhv,
+			postav, levelp, apad, style);
 		if (ix < ixmax)
 		    sv_catpvn(retval, ",", 1);
 	    }
 	    if (ixmax >= 0) {
-		SV * const opad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), (*levelp)-1);
 		sv_catsv(retval, totpad);
-		sv_catsv(retval, opad);
-		SvREFCNT_dec(opad);
+		sv_catsv(retval, level_pad(aTHX_ style, (*levelp)-1));
 	    }
 	    if (name[0] == '@')
 		sv_catpvn(retval, ")", 1);
 	    else
 		sv_catpvn(retval, "]", 1);
-	    SvREFCNT_dec(ixsv);
 	    SvREFCNT_dec(totpad);
 	    Safefree(iname);
 	}
 	else if (realtype == SVt_PVHV) {
 	    SV *totpad, *newapad;
-	    SV *sname;
 	    HE *entry;
 	    char *key;
 	    I32 klen;
 	    SV *hval;
 	    AV *keys = NULL;
+	    STRLEN inamelen;
+	    SV *sortkeys = style->sortkeys;
 	
+	    /* the name of each value is built in place after this prefix */
 	    SV * const iname = newSVpvn(name, namelen);
 	    if (name[0] == '%') {
 		sv_catpvn(retval, "(", 1);
@@ -629,9 +676,14 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		sv_catpvn(iname, "->", 2);
 	    }
 	    sv_catpvn(iname, "{", 1);
-	    totpad = newSVsv(sep);
-	    sv_catsv(totpad, pad);
+	    inamelen = SvCUR(iname);
+	    totpad = newSVsv(style->sep);
+	    sv_catsv(totpad, style->pad);
 	    sv_catsv(totpad, apad);
+	    if (style->indent >= 2)
+		newapad = newSVsv(apad);
+	    else
+		newapad = apad;
 	
 	    /* If requested, get a sorted/filtered array of hash keys */
 	    if (sortkeys) {
@@ -639,21 +691,26 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 #if PERL_VERSION < 8
                     sortkeys = sv_2mortal(newSVpvn("Data::Dumper::_sortkeys", 23));
 #else
+		    bool bytes = !SvRMAGICAL(ival);
 		    keys = newAV();
+		    av_extend(keys, HvUSEDKEYS((HV*)ival));
 		    (void)hv_iterinit((HV*)ival);
 		    while ((entry = hv_iternext((HV*)ival))) {
 			sv = hv_iterkeysv(entry);
 			SvREFCNT_inc(sv);
 			av_push(keys, sv);
+			if (!SvPOK(sv) || SvUTF8(sv))
+			    bytes = FALSE;
 		    }
 # ifdef USE_LOCALE_NUMERIC
 		    sortsv(AvARRAY(keys), 
 			   av_len(keys)+1, 
-			   IN_LOCALE ? Perl_sv_cmp_locale : Perl_sv_cmp);
+			   IN_LOCALE ? Perl_sv_cmp_locale
+			   : bytes ? key_cmp : Perl_sv_cmp);
 # else
 		    sortsv(AvARRAY(keys), 
 			   av_len(keys)+1, 
-			   Perl_sv_cmp);
+			   bytes ? key_cmp : Perl_sv_cmp);
 # endif
 #endif
 		}
@@ -680,9 +737,8 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
             /* foreach (keys %hash) */
             for (i = 0; 1; i++) {
 		char *nkey;
-                char *nkey_buffer = NULL;
 		I32 nticks = 0;
-		SV* keysv;
+		SV* keysv = NULL;
 		STRLEN keylen;
                 I32 nlen;
 		bool do_utf8 = FALSE;
@@ -705,13 +761,21 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                                    SvUTF8(keysv) ? -(I32)keylen : keylen, 0);
 		    hval = svp ? *svp : sv_mortalcopy(&PL_sv_undef);
 		}
+		else if (HeKLEN(entry) != HEf_SVKEY
+			 && !HeKUTF8(entry) && !HeKWASUTF8(entry)) {
+		    key = HeKEY(entry);
+		    keylen = HeKLEN(entry);
+		    hval = hv_iterval((HV*)ival, entry);
+		}
 		else {
 		    keysv = hv_iterkeysv(entry);
 		    hval = hv_iterval((HV*)ival, entry);
 		}
 
-		key = SvPV(keysv, keylen);
-		do_utf8 = DO_UTF8(keysv);
+		if (keysv) {
+		    key = SvPV(keysv, keylen);
+		    do_utf8 = DO_UTF8(keysv);
+		}
 		klen = keylen;
 
                 sv_catsv(retval, totpad);
@@ -737,16 +801,18 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                    more common doesn't need quoting case.
                    The code is also smaller (22044 vs 22260) because I've been
                    able to pull the common logic out to both sides.  */
-                if (quotekeys || needs_quote(key)) {
+                if (style->quotekeys || needs_quote(key)) {
                     if (do_utf8) {
                         STRLEN ocur = SvCUR(retval);
                         nlen = esc_q_utf8(aTHX_ retval, key, klen);
                         nkey = SvPVX(retval) + ocur;
                     }
                     else {
+                        STRLEN ocur = SvCUR(retval);
 		        nticks = num_q(key, klen);
-			New(0, nkey_buffer, klen+nticks+3, char);
-                        nkey = nkey_buffer;
+			/* quote the key straight into the output */
+			SvGROW(retval, ocur+klen+nticks+3);
+                        nkey = SvPVX(retval) + ocur;
 			nkey[0] = '\'';
 			if (nticks)
 			    klen += esc_q(nkey+1, key, klen);
@@ -755,7 +821,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 			nkey[++klen] = '\'';
 			nkey[++klen] = '\0';
                         nlen = klen;
-                        sv_catpvn(retval, nkey, klen);
+                        SvCUR_set(retval, ocur+klen);
 		    }
                 }
                 else {
@@ -763,50 +829,35 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                     nlen = klen;
                     sv_catpvn(retval, nkey, klen);
 		}
-                sname = newSVsv(iname);
-                sv_catpvn(sname, nkey, nlen);
-                sv_catpvn(sname, "}", 1);
-
-		sv_catsv(retval, pair);
-		if (indent >= 2) {
-		    char *extra;
-		    I32 elen = 0;
-		    newapad = newSVsv(apad);
-		    New(0, extra, klen+4+1, char);
-		    while (elen < (klen+4))
-			extra[elen++] = ' ';
-		    extra[elen] = '\0';
-		    sv_catpvn(newapad, extra, elen);
-		    Safefree(extra);
+                SvCUR_set(iname, inamelen);
+                sv_catpvn(iname, nkey, nlen);
+                sv_catpvn(iname, "}", 1);
+
+		sv_catsv(retval, style->pair);
+		if (style->indent >= 2) {
+		    SvCUR_set(newapad, SvCUR(apad));
+		    (void)sv_x(aTHX_ newapad, " ", 1, klen+4);
 		}
-		else
-		    newapad = apad;
-
-		DD_dump(aTHX_ hval, SvPVX_const(sname), SvCUR(sname), retval, seenhv,
-			postav, levelp,	indent, pad, xpad, newapad, sep, pair,
-			freezer, toaster, purity, deepcopy, quotekeys, bless,
-			maxdepth, sortkeys);
-		SvREFCNT_dec(sname);
-		Safefree(nkey_buffer);
-		if (indent >= 2)
-		    SvREFCNT_dec(newapad);
+
+		DD_dump(aTHX_ hval, SvPVX_const(iname), SvCUR(iname), retval, seenhv,
+			postav, levelp, newapad, style);
 	    }
 	    if (i) {
-		SV *opad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), *levelp-1);
 		sv_catsv(retval, totpad);
-		sv_catsv(retval, opad);
-		SvREFCNT_dec(opad);
+		sv_catsv(retval, level_pad(aTHX_ style, *levelp-1));
 	    }
 	    if (name[0] == '%')
 		sv_catpvn(retval, ")", 1);
 	    else
 		sv_catpvn(retval, "}", 1);
+	    if (newapad != apad)
+		SvREFCNT_dec(newapad);
 	    SvREFCNT_dec(iname);
 	    SvREFCNT_dec(totpad);
 	}
 	else if (realtype == SVt_PVCV) {
 	    sv_catpvn(retval, "sub { \"DUMMY\" }", 15);
-	    if (purity)
+	    if (style->purity)
 		warn("Encountered CODE ref, using dummy placeholder");
 	}
 	else {
@@ -817,7 +868,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    I32 plen;
 	    I32 pticks;
 
-	    if (indent >= 2) {
+	    if (style->indent >= 2) {
 		SvREFCNT_dec(apad);
 		apad = blesspad;
 	    }
@@ -841,13 +892,12 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	        sv_catpvn(retval, realpack, strlen(realpack));
 	    }
 	    sv_catpvn(retval, "' )", 3);
-	    if (toaster && SvPOK(toaster) && SvCUR(toaster)) {
+	    if (style->toaster) {
 		sv_catpvn(retval, "->", 2);
-		sv_catsv(retval, toaster);
+		sv_catsv(retval, style->toaster);
 		sv_catpvn(retval, "()", 2);
 	    }
 	}
-	SvREFCNT_dec(ipad);
 	(*levelp)--;
     }
     else {
@@ -931,7 +981,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    }
 	    SvCUR_set(retval, SvCUR(retval)+i);
 
-	    if (purity) {
+	    if (style->purity) {
 		static const char* const entries[] = { "{SCALAR}", "{ARRAY}", "{HASH}" };
 		static const STRLEN sizes[] = { 8, 7, 6 };
 		SV *e;
@@ -958,14 +1008,11 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 			e = newRV_inc(e);
 			
 			SvCUR_set(newapad, 0);
-			if (indent >= 2)
+			if (style->indent >= 2)
 			    (void)sv_x(aTHX_ newapad, " ", 1, SvCUR(postentry));
 			
 			DD_dump(aTHX_ e, SvPVX_const(nname), SvCUR(nname), postentry,
-				seenhv, postav, &nlevel, indent, pad, xpad,
-				newapad, sep, pair, freezer, toaster, purity,
-				deepcopy, quotekeys, bless, maxdepth, 
-				sortkeys);
+				seenhv, postav, &nlevel, newapad, style);
 			SvREFCNT_dec(e);
 		    }
 		}
@@ -996,7 +1043,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
     }
 
     if (idlen) {
-	if (deepcopy)
+	if (style->deepcopy)
 	    (void)hv_delete(seenhv, id, idlen, G_DISCARD);
 	else if (namelen && seenentry) {
 	    SV *mark = *av_fetch(seenentry, 2, TRUE);
@@ -1009,6 +1056,24 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 
 MODULE = Data::Dumper		PACKAGE = Data::Dumper         PREFIX = Data_Dumper_
 
+BOOT:
+{
+    MY_CXT_INIT;
+    MY_CXT.buf = NULL;
+}
+
+#ifdef USE_ITHREADS
+
+void
+CLONE(...)
+    CODE:
+    {
+	MY_CXT_CLONE;
+	MY_CXT.buf = NULL;	/* the buffer belongs to the parent */
+    }
+
+#endif
+
 #
 # This is the exact equivalent of Dump.  Well, almost. The things that are
 # different as of now (due to Laziness):
@@ -1026,13 +1091,13 @@ Data_Dumper_Dumpxs(href, ...)
 	    HV *seenhv = NULL;
 	    AV *postav, *todumpav, *namesav;
 	    I32 level = 0;
-	    I32 indent, terse, i, imax, postlen;
+	    I32 terse, i, imax, postlen;
 	    SV **svp;
-	    SV *val, *name, *pad, *xpad, *apad, *sep, *pair, *varname;
-	    SV *freezer, *toaster, *bless, *sortkeys;
-	    I32 purity, deepcopy, quotekeys, maxdepth = 0;
+	    SV *val, *name, *apad, *varname;
+	    Style style;
 	    char tmpbuf[1024];
 	    I32 gimme = GIMME;
+	    dMY_CXT;
 
 	    if (!SvROK(href)) {		/* call new to get an object first */
 		if (items < 2)
@@ -1061,12 +1126,14 @@ Data_Dumper_Dumpxs(href, ...)
 
 	    todumpav = namesav = NULL;
 	    seenhv = NULL;
-	    val = pad = xpad = apad = sep = pair = varname
-		= freezer = toaster = bless = sortkeys = &PL_sv_undef;
+	    val = apad = varname = &PL_sv_undef;
+	    style.pad = style.xpad = style.sep = style.pair = style.bless
+		= &PL_sv_undef;
+	    style.freezer = style.toaster = style.sortkeys = NULL;
 	    name = sv_newmortal();
-	    indent = 2;
-	    terse = purity = deepcopy = 0;
-	    quotekeys = 1;
+	    style.indent = 2;
+	    terse = style.purity = style.deepcopy = style.maxdepth = 0;
+	    style.quotekeys = 1;
 	
 	    retval = newSVpvn("", 0);
 	    if (SvROK(href)
@@ -1080,9 +1147,9 @@ Data_Dumper_Dumpxs(href, ...)
 		if ((svp = hv_fetch(hv, "names", 5, FALSE)) && SvROK(*svp))
 		    namesav = (AV*)SvRV(*svp);
 		if ((svp = hv_fetch(hv, "indent", 6, FALSE)))
-		    indent = SvIV(*svp);
+		    style.indent = SvIV(*svp);
 		if ((svp = hv_fetch(hv, "purity", 6, FALSE)))
-		    purity = SvIV(*svp);
+		    style.purity = SvIV(*svp);
 		if ((svp = hv_fetch(hv, "terse", 5, FALSE)))
 		    terse = SvTRUE(*svp);
 #if 0 /* useqq currently unused */
@@ -1090,47 +1157,59 @@ Data_Dumper_Dumpxs(href, ...)
 		    useqq = SvTRUE(*svp);
 #endif
 		if ((svp = hv_fetch(hv, "pad", 3, FALSE)))
-		    pad = *svp;
+		    style.pad = *svp;
 		if ((svp = hv_fetch(hv, "xpad", 4, FALSE)))
-		    xpad = *svp;
+		    style.xpad = *svp;
 		if ((svp = hv_fetch(hv, "apad", 4, FALSE)))
 		    apad = *svp;
 		if ((svp = hv_fetch(hv, "sep", 3, FALSE)))
-		    sep = *svp;
+		    style.sep = *svp;
 		if ((svp = hv_fetch(hv, "pair", 4, FALSE)))
-		    pair = *svp;
+		    style.pair = *svp;
 		if ((svp = hv_fetch(hv, "varname", 7, FALSE)))
 		    varname = *svp;
-		if ((svp = hv_fetch(hv, "freezer", 7, FALSE)))
-		    freezer = *svp;
-		if ((svp = hv_fetch(hv, "toaster", 7, FALSE)))
-		    toaster = *svp;
+		if ((svp = hv_fetch(hv, "freezer", 7, FALSE))
+		    && SvPOK(*svp) && SvCUR(*svp))
+		    style.freezer = *svp;
+		if ((svp = hv_fetch(hv, "toaster", 7, FALSE))
+		    && SvPOK(*svp) && SvCUR(*svp))
+		    style.toaster = *svp;
 		if ((svp = hv_fetch(hv, "deepcopy", 8, FALSE)))
-		    deepcopy = SvTRUE(*svp);
+		    style.deepcopy = SvTRUE(*svp);
 		if ((svp = hv_fetch(hv, "quotekeys", 9, FALSE)))
-		    quotekeys = SvTRUE(*svp);
+		    style.quotekeys = SvTRUE(*svp);
 		if ((svp = hv_fetch(hv, "bless", 5, FALSE)))
-		    bless = *svp;
+		    style.bless = *svp;
 		if ((svp = hv_fetch(hv, "maxdepth", 8, FALSE)))
-		    maxdepth = SvIV(*svp);
+		    style.maxdepth = SvIV(*svp);
 		if ((svp = hv_fetch(hv, "sortkeys", 8, FALSE))) {
-		    sortkeys = *svp;
-		    if (! SvTRUE(sortkeys))
-			sortkeys = NULL;
-		    else if (! (SvROK(sortkeys) &&
-				SvTYPE(SvRV(sortkeys)) == SVt_PVCV) )
+		    style.sortkeys = *svp;
+		    if (! SvTRUE(style.sortkeys))
+			style.sortkeys = NULL;
+		    else if (! (SvROK(style.sortkeys) &&
+				SvTYPE(SvRV(style.sortkeys)) == SVt_PVCV) )
 		    {
 			/* flag to use qsortsv() for sorting hash keys */	
-			sortkeys = &PL_sv_yes; 
+			style.sortkeys = &PL_sv_yes; 
 		    }
 		}
 		postav = newAV();
+		style.xpads = newAV();
 
 		if (todumpav)
 		    imax = av_len(todumpav);
 		else
 		    imax = -1;
-		valstr = newSVpvn("",0);
+		/* Each value is dumped into a buffer that is kept between
+		 * calls, so that dumping small structures over and over
+		 * does not grow a fresh string every time.  A nested call
+		 * (from a Freezer or Sortkeys callback) gets its own.
+		 */
+		valstr = MY_CXT.buf;
+		MY_CXT.buf = NULL;
+		if (!valstr)
+		    valstr = newSV(DD_BUF_INIT);
+		sv_setpvn(valstr, "", 0);
 		for (i = 0; i <= imax; ++i) {
 		    SV *newapad;
 		
@@ -1179,7 +1258,7 @@ Data_Dumper_Dumpxs(href, ...)
 			sv_catpvn(name, tmpbuf, nchars);
 		    }
 		
-		    if (indent >= 2 && !terse) {
+		    if (style.indent >= 2 && !terse) {
 			SV * const tmpsv = sv_x(aTHX_ NULL, " ", 1, SvCUR(name)+3);
 			newapad = newSVsv(apad);
 			sv_catsv(newapad, tmpsv);
@@ -1189,25 +1268,26 @@ Data_Dumper_Dumpxs(href, ...)
 			newapad = apad;
 		
 		    DD_dump(aTHX_ val, SvPVX_const(name), SvCUR(name), valstr, seenhv,
-			    postav, &level, indent, pad, xpad, newapad, sep, pair,
-			    freezer, toaster, purity, deepcopy, quotekeys,
-			    bless, maxdepth, sortkeys);
+			    postav, &level, newapad, &style);
 		
-		    if (indent >= 2 && !terse)
+		    if (style.indent >= 2 && !terse)
 			SvREFCNT_dec(newapad);
 
 		    postlen = av_len(postav);
+		    SvGROW(retval, SvCUR(retval) + SvCUR(name) + SvCUR(valstr) + 64);
+		    sv_catsv(retval, style.pad);
 		    if (postlen >= 0 || !terse) {
-			sv_insert(valstr, 0, 0, " = ", 3);
-			sv_insert(valstr, 0, 0, SvPVX_const(name), SvCUR(name));
-			sv_catpvn(valstr, ";", 1);
+			sv_catpvn(retval, SvPVX_const(name), SvCUR(name));
+			sv_catpvn(retval, " = ", 3);
+			sv_catsv(retval, valstr);
+			sv_catpvn(retval, ";", 1);
 		    }
-		    sv_catsv(retval, pad);
-		    sv_catsv(retval, valstr);
-		    sv_catsv(retval, sep);
+		    else
+			sv_catsv(retval, valstr);
+		    sv_catsv(retval, style.sep);
 		    if (postlen >= 0) {
 			I32 i;
-			sv_catsv(retval, pad);
+			sv_catsv(retval, style.pad);
 			for (i = 0; i <= postlen; ++i) {
 			    SV *elem;
 			    svp = av_fetch(postav, i, FALSE);
@@ -1215,13 +1295,13 @@ Data_Dumper_Dumpxs(href, ...)
 				sv_catsv(retval, elem);
 				if (i < postlen) {
 				    sv_catpvn(retval, ";", 1);
-				    sv_catsv(retval, sep);
-				    sv_catsv(retval, pad);
+				    sv_catsv(retval, style.sep);
+				    sv_catsv(retval, style.pad);
 				}
 			    }
 			}
 			sv_catpvn(retval, ";", 1);
-			    sv_catsv(retval, sep);
+			    sv_catsv(retval, style.sep);
 		    }
 		    sv_setpvn(valstr, "", 0);
 		    if (gimme == G_ARRAY) {
@@ -1231,7 +1311,11 @@ Data_Dumper_Dumpxs(href, ...)
 		    }
 		}
 		SvREFCNT_dec(postav);
-		SvREFCNT_dec(valstr);
+		SvREFCNT_dec(style.xpads);
+		if (!MY_CXT.buf && SvLEN(valstr) <= DD_BUF_KEEP)
+		    MY_CXT.buf = valstr;
+		else
+		    SvREFCNT_dec(valstr);
 	    }
 	    else
 		croak("Call to new() method failed to return HASH ref");
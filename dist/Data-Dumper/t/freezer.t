@@ -75,6 +75,30 @@ like($dumped_foo, qr/frozed/,
     is($warned, 1, "A freeze() which die()s should warn with useperl.");
 }
 
+# a freeze() which calls Dumper itself must not disturb the outer dump
+my $nested = Test4->new("nested");
+my $dumped_nested = Dumper([ $nested, "after" ]);
+like($dumped_nested, qr/'inner' => '\$VAR1 = \[\n\s+1,/,
+     "Dumper called from freeze() works.");
+like($dumped_nested, qr/'after'\n\s*\];\n\z/,
+     "Outer dump continues after a nested one.");
+is(Dumper([ $nested, "after" ]), $dumped_nested,
+   "Repeated dumps give the same result.");
+
+# a freeze() which deletes a key of the hash being dumped, still to come
+# with Sortkeys
+{
+    local $Data::Dumper::Sortkeys = 1;
+    our %h = (aaa => Test5->new("deleter"), zzz => [ 1 .. 3 ]);
+    my $dumped_xs = Dumper(\%h);
+    %h = (aaa => Test5->new("deleter"), zzz => [ 1 .. 3 ]);
+    local $Data::Dumper::Useperl = 1;
+    is($dumped_xs, Dumper(\%h),
+       "A freeze() may delete a key still to be dumped.");
+    like($dumped_xs, qr/'zzz' => undef/,
+         "The deleted key is dumped as undef.");
+}
+
 # a package with a freeze() which returns a non-ref
 package Test1;
 sub new { bless({name => $_[1]}, $_[0]) }
@@ -91,3 +115,17 @@ sub new { bless({name => $_[1]}, $_[0]) }
 package Test3;
 sub new { bless({name => $_[1]}, $_[0]) }
 sub freeze { die "freeze() is broked" }
+
+# a package with a freeze() which deletes from %main::h
+package Test5;
+sub new { bless({name => $_[1]}, $_[0]) }
+sub freeze { delete $main::h{zzz} }
+
+# a package with a freeze() which calls Dumper
+package Test4;
+sub new { bless({name => $_[1]}, $_[0]) }
+sub freeze {
+    my $self = shift;
+    local $Data::Dumper::Freezer = '';
+    $self->{inner} = Data::Dumper::Dumper([ 1, { a => 2 } ]);
+}
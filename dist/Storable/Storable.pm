@@ -23,7 +23,7 @@ use AutoLoader;
 use FileHandle;
 use vars qw($canonical $forgive_me $VERSION);
 
-$VERSION = '2.22';
+$VERSION = '2.23';
 *AUTOLOAD = \&AutoLoader::AUTOLOAD;		# Grrr...
 
 #
@@ -556,6 +556,13 @@ The heart of Storable is written in C for decent speed. Extra low-level
 optimizations have been made when manipulating perl internals, to
 sacrifice encapsulation for the benefit of greater speed.
 
+C<store_fd> and C<fd_retrieve> (and the routines built on them) write and
+read the image a piece at a time, so it is never held in memory whole.
+When retrieving from a plain file of at least 64K, with no I/O layers
+other than C<:unix>, C<:perlio> or C<:stdio>, Storable maps the file into
+memory where the system allows, and reads it as C<thaw> reads a frozen
+string.  The file is left positioned just after the image, as usual.
+
 =head1 CANONICAL REPRESENTATION
 
 Normally, Storable stores elements of hashes in the order they are
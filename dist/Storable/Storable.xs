@@ -334,6 +334,21 @@ typedef unsigned long stag_t;	/* Used by pre-0.6 binary format */
 #define USE_PTR_TABLE
 #endif
 
+/*
+ * Files are retrieved from a read-only mapping of the file when possible,
+ * which reads them exactly as frozen strings are read, rather than making a
+ * PerlIO call for every item.
+ */
+#if defined(HAS_MMAP) && defined(USE_PERLIO) && !defined(PERLIO_IS_STDIO) \
+	&& defined(SAVEDESTRUCTOR_X) && !defined(WIN32)
+#define USE_MMAP
+#include <sys/mman.h>
+#ifndef MAP_FAILED
+#define MAP_FAILED	((Mmap_t) -1)
+#endif
+#define MMAP_MIN	(64 * 1024)	/* Smaller files are read as before */
+#endif
+
 /*
  * Fields s_tainted and s_dirty are prefixed with s_ because Perl's include
  * files remap tainted and dirty when threading is enabled.  That's bad for
@@ -516,6 +531,26 @@ static stcxt_t *Context_ptr = NULL;
 	}							\
   } STMT_END
 
+/*
+ * Get a hash key of `size' bytes, setting `k' to point at it.  Keys are
+ * used straight from the memory buffer when there is one; otherwise they
+ * are read into kbuf, so the same rule applies as when reading into kbuf
+ * directly: no recursion before the key has been used.
+ */
+#define READ_KEY(k,size)						\
+  STMT_START {									\
+	if (!cxt->fio && mptr + (size) <= mend) {	\
+		k = mptr;								\
+		mptr += size;							\
+	} else {									\
+		KBUFCHK((STRLEN)size);					\
+		if (size)								\
+			READ(kbuf, size);					\
+		kbuf[size] = '\0';						\
+		k = kbuf;								\
+	}											\
+  } STMT_END
+
 /*
  * memory buffer handling
  */
@@ -5160,8 +5195,8 @@ static SV *retrieve_array(pTHX_ stcxt_t *cxt, const char *cname)
 		sv = retrieve(aTHX_ cxt, 0);			/* Retrieve item */
 		if (!sv)
 			return (SV *) 0;
-		if (av_store(av, i, sv) == 0)
-			return (SV *) 0;
+		AvARRAY(av)[i] = sv;			/* Pre-extended, and plain */
+		AvFILLp(av) = i;
 	}
 
 	TRACEME(("ok (retrieve_array at 0x%"UVxf")", PTR2UV(av)));
@@ -5184,6 +5219,7 @@ static SV *retrieve_hash(pTHX_ stcxt_t *cxt, const char *cname)
 {
 	I32 len;
 	I32 size;
+	const char *key;
 	I32 i;
 	HV *hv;
 	SV *sv;
@@ -5224,17 +5260,14 @@ static SV *retrieve_hash(pTHX_ stcxt_t *cxt, const char *cname)
 		 */
 
 		RLEN(size);						/* Get key size */
-		KBUFCHK((STRLEN)size);					/* Grow hash key read pool if needed */
-		if (size)
-			READ(kbuf, size);
-		kbuf[size] = '\0';				/* Mark string end, just in case */
-		TRACEME(("(#%d) key '%s'", i, kbuf));
+		READ_KEY(key, size);
+		TRACEME(("(#%d) key '%.*s'", i, (int) size, key));
 
 		/*
 		 * Enter key/value pair into hash table.
 		 */
 
-		if (hv_store(hv, kbuf, (U32) size, sv, 0) == 0)
+		if (hv_store(hv, key, (U32) size, sv, 0) == 0)
 			return (SV *) 0;
 	}
 
@@ -5259,6 +5292,7 @@ static SV *retrieve_flag_hash(pTHX_ stcxt_t *cxt, const char *cname)
     dVAR;
     I32 len;
     I32 size;
+    const char *key;
     I32 i;
     HV *hv;
     SV *sv;
@@ -5355,23 +5389,20 @@ static SV *retrieve_flag_hash(pTHX_ stcxt_t *cxt, const char *cname)
 #endif
 
             RLEN(size);						/* Get key size */
-            KBUFCHK((STRLEN)size);				/* Grow hash key read pool if needed */
-            if (size)
-                READ(kbuf, size);
-            kbuf[size] = '\0';				/* Mark string end, just in case */
-            TRACEME(("(#%d) key '%s' flags %X store_flags %X", i, kbuf,
-		     flags, store_flags));
+            READ_KEY(key, size);
+            TRACEME(("(#%d) key '%.*s' flags %X store_flags %X", i,
+		     (int) size, key, flags, store_flags));
 
             /*
              * Enter key/value pair into hash table.
              */
 
 #ifdef HAS_RESTRICTED_HASHES
-            if (hv_store_flags(hv, kbuf, size, sv, 0, store_flags) == 0)
+            if (hv_store_flags(hv, key, size, sv, 0, store_flags) == 0)
                 return (SV *) 0;
 #else
             if (!(store_flags & HVhek_PLACEHOLD))
-                if (hv_store(hv, kbuf, size, sv, 0) == 0)
+                if (hv_store(hv, key, size, sv, 0) == 0)
                     return (SV *) 0;
 #endif
 	}
@@ -5576,6 +5607,7 @@ static SV *old_retrieve_hash(pTHX_ stcxt_t *cxt, const char *cname)
 {
 	I32 len;
 	I32 size;
+	const char *key;
 	I32 i;
 	HV *hv;
 	SV *sv = (SV *) 0;
@@ -5635,17 +5667,14 @@ static SV *old_retrieve_hash(pTHX_ stcxt_t *cxt, const char *cname)
 		if (c != SX_KEY)
 			(void) retrieve_other(aTHX_ (stcxt_t *) 0, 0);	/* Will croak out */
 		RLEN(size);						/* Get key size */
-		KBUFCHK((STRLEN)size);					/* Grow hash key read pool if needed */
-		if (size)
-			READ(kbuf, size);
-		kbuf[size] = '\0';				/* Mark string end, just in case */
-		TRACEME(("(#%d) key '%s'", i, kbuf));
+		READ_KEY(key, size);
+		TRACEME(("(#%d) key '%.*s'", i, (int) size, key));
 
 		/*
 		 * Enter key/value pair into hash table.
 		 */
 
-		if (hv_store(hv, kbuf, (U32) size, sv, 0) == 0)
+		if (hv_store(hv, key, (U32) size, sv, 0) == 0)
 			return (SV *) 0;
 	}
 
@@ -6009,6 +6038,91 @@ first_time:		/* Will disappear when support for old format is dropped */
 	return sv;	/* Ok */
 }
 
+#ifdef USE_MMAP
+
+struct mmap_input {
+	Mmap_t base;
+	size_t len;
+};
+
+/*
+ * unmap_input
+ *
+ * Destructor for the mapping made by mmap_input().
+ */
+static void unmap_input(pTHX_ void *p)
+{
+	struct mmap_input *m = (struct mmap_input *) p;
+
+	TRACEME(("unmapping %lu bytes", (unsigned long) m->len));
+	munmap(m->base, m->len);
+	Safefree(m);
+}
+
+/*
+ * mmap_input
+ *
+ * Map the file that `f' reads, when it is a plain file with no layers that
+ * transform the data, and switch the context over to reading the rest of
+ * the image from memory.  The mapping is released when the current scope
+ * is left, croaking or not.  Returns true if the file was mapped.
+ */
+static int mmap_input(pTHX_ stcxt_t *cxt, PerlIO *f)
+{
+	Stat_t st;
+	Off_t pos;
+	Mmap_t base;
+	struct mmap_input *m;
+	AV *layers;
+	I32 i;
+	int fd = PerlIO_fileno(f);
+
+	if (fd < 0 || PerlIO_isutf8(f))
+		return 0;
+
+	layers = (AV *) sv_2mortal((SV *) PerlIO_get_layers(aTHX_ f));
+	for (i = 0; i <= av_len(layers); i += 3) {	/* name, arg, flags */
+		SV **name = av_fetch(layers, i, FALSE);
+		if (!name || !SvPOK(*name))
+			return 0;
+		if (strNE(SvPVX(*name), "unix") && strNE(SvPVX(*name), "perlio")
+			&& strNE(SvPVX(*name), "stdio"))
+			return 0;
+	}
+
+	if (PerlLIO_fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return 0;
+	pos = PerlIO_tell(f);
+	if (pos < 0 || st.st_size - pos < MMAP_MIN
+		|| (Off_t) (size_t) st.st_size != st.st_size)
+		return 0;
+
+	base = (Mmap_t) mmap(0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+		fd, 0);
+	if (base == MAP_FAILED)
+		return 0;
+
+	TRACEME(("mapped %lu bytes, reading from offset %lu",
+		(unsigned long) st.st_size, (unsigned long) pos));
+
+	New(10003, m, 1, struct mmap_input);
+	m->base = base;
+	m->len = (size_t) st.st_size;
+	SAVEDESTRUCTOR_X(unmap_input, m);
+
+	cxt->membuf_ro = 1;
+	StructCopy(&cxt->membuf, &cxt->msaved, struct extendable);
+	mbase = (char *) base;
+	msiz = m->len;
+	mptr = mbase + pos;
+	mend = mbase + msiz;
+	cxt->fio = 0;
+
+	return 1;
+}
+
+#endif	/* USE_MMAP */
+
 /*
  * do_retrieve
  *
@@ -6025,6 +6139,9 @@ static SV *do_retrieve(
 	SV *sv;
 	int is_tainted;				/* Is input source tainted? */
 	int pre_06_fmt = 0;			/* True with pre Storable 0.6 formats */
+#ifdef USE_MMAP
+	int mapped;					/* Reading from a mapping of file f? */
+#endif
 
 	TRACEME(("do_retrieve (optype = 0x%x)", optype));
 
@@ -6146,6 +6263,11 @@ static SV *do_retrieve(
 
 	ASSERT(is_retrieving(aTHX), ("within retrieve operation"));
 
+#ifdef USE_MMAP
+	ENTER;
+	mapped = f && mmap_input(aTHX_ cxt, f);
+#endif
+
 	sv = retrieve(aTHX_ cxt, 0);		/* Recursively retrieve object, get root SV */
 
 	/*
@@ -6155,6 +6277,20 @@ static SV *do_retrieve(
 	if (!f && in)
 		MBUF_RESTORE();
 
+#ifdef USE_MMAP
+	/*
+	 * Leave the file positioned just after the image, as reading it
+	 * through PerlIO would have, since there may be more after it.
+	 */
+
+	if (mapped) {
+		Off_t used = mptr - mbase;
+		MBUF_RESTORE();
+		(void) PerlIO_seek(f, used, SEEK_SET);
+	}
+	LEAVE;
+#endif
+
 	pre_06_fmt = cxt->hseen != NULL;	/* Before we clean context */
 
 	/*
@@ -17,9 +17,9 @@ sub BEGIN {
 }
 
 
-use Storable qw(store retrieve nstore);
+use Storable qw(store retrieve nstore store_fd fd_retrieve);
 
-print "1..14\n";
+print "1..19\n";
 
 $a = 'toto';
 $b = \$a;
@@ -66,4 +66,31 @@ print "ok 13\n";
 print "not " if length $root->[1];
 print "ok 14\n";
 
+# Files big enough to be read through a memory mapping
+my @big = map { { 'id' => $_, 'name' => "item $_" } } 1 .. 5000;
+store(\@big, 'store');
+print "not " unless -s 'store' > 64 * 1024;
+print "ok 15\n";
+$root = retrieve('store');
+print "not " unless &dump($root) eq &dump(\@big);
+print "ok 16\n";
+
+# Several images in one file are read one after the other
+open(FILE, '>store') || die "Can't create store: $!";
+binmode FILE;
+store_fd(\@big, \*FILE) && store_fd(\@a, \*FILE) && print FILE "end"
+    || die "Can't write store: $!";
+close(FILE);
+open(FILE, 'store') || die "Can't open store: $!";
+binmode FILE;
+$root = fd_retrieve(\*FILE);
+print "not " unless &dump($root) eq &dump(\@big);
+print "ok 17\n";
+$root = fd_retrieve(\*FILE);
+print "not " unless &dump($root) eq $d1;
+print "ok 18\n";
+print "not " unless <FILE> eq 'end';
+print "ok 19\n";
+close(FILE);
+
 END { 1 while unlink('store', 'nstore') }
@@ -3,7 +3,7 @@ package Thread::Queue;
 use strict;
 use warnings;
 
-our $VERSION = '2.11';
+our $VERSION = '2.12';
 
 use threads::shared 1.21;
 use Scalar::Util 1.10 qw(looks_like_number blessed reftype refaddr);
@@ -18,7 +18,7 @@ my ($validate_count, $validate_index);
 sub new
 {
     my $class = shift;
-    my @queue :shared = map { shared_clone($_) } @_;
+    my @queue :shared = map { ref($_) ? shared_clone($_) : $_ } @_;
     return bless(\@queue, $class);
 }
 
@@ -27,7 +27,7 @@ sub enqueue
 {
     my $queue = shift;
     lock(@$queue);
-    push(@$queue, map { shared_clone($_) } @_)
+    push(@$queue, map { ref($_) ? shared_clone($_) : $_ } @_)
         and cond_signal(@$queue);
 }
 
@@ -55,9 +55,7 @@ sub dequeue
     return shift(@$queue) if ($count == 1);
 
     # Return multiple items
-    my @items;
-    push(@items, shift(@$queue)) for (1..$count);
-    return @items;
+    return map { shift(@$queue) } 1..$count;
 }
 
 # Return items from the head of a queue with no blocking
@@ -72,12 +70,9 @@ sub dequeue_nb
     return shift(@$queue) if ($count == 1);
 
     # Return multiple items
-    my @items;
-    for (1..$count) {
-        last if (! @$queue);
-        push(@items, shift(@$queue));
-    }
-    return @items;
+    my $avail = @$queue;
+    $count = $avail if ($count > $avail);
+    return map { shift(@$queue) } 1..$count;
 }
 
 # Return an item without removing it from a queue
@@ -114,7 +109,7 @@ sub insert
     }
 
     # Add new items to the queue
-    push(@$queue, map { shared_clone($_) } @_);
+    push(@$queue, map { ref($_) ? shared_clone($_) : $_ } @_);
 
     # Add previous items back onto the queue
     push(@$queue, @tmp);
@@ -209,7 +204,7 @@ Thread::Queue - Thread-safe queues
 
 =head1 VERSION
 
-This document describes Thread::Queue version 2.11
+This document describes Thread::Queue version 2.12
 
 =head1 SYNOPSIS
 
@@ -462,7 +457,7 @@ Thread::Queue Discussion Forum on CPAN:
 L<http://www.cpanforum.com/dist/Thread-Queue>
 
 Annotated POD for Thread::Queue:
-L<http://annocpan.org/~JDHEDDEN/Thread-Queue-2.11/lib/Thread/Queue.pm>
+L<http://annocpan.org/~JDHEDDEN/Thread-Queue-2.12/lib/Thread/Queue.pm>
 
 Source repository:
 L<http://code.google.com/p/thread-queue/>
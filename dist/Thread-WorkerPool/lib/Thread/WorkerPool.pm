@@ -0,0 +1,441 @@
+package Thread::WorkerPool;
+
+use strict;
+use warnings;
+
+our $VERSION = '0.02';
+
+use threads 1.77;
+use threads::shared 1.21;
+use Thread::Queue 2.12;
+use Storable 2.22 ();
+use Scalar::Util 1.10 qw(looks_like_number reftype refaddr weaken);
+use Exporter 5.57 'import';
+
+our @EXPORT_OK = qw(pmap pgrep);
+
+# Carp errors from threads::shared calls should complain about caller
+our @CARP_NOT = ("threads::shared");
+
+# Number of workers when not specified
+our $WORKERS = 4;
+
+# Live pools, so that any still around at exit can be shut down before
+# perl complains about running threads
+my %POOLS;
+
+# Create a pool of worker threads, each running the given code for every
+# task it picks up
+sub new
+{
+    my ($class, %args) = @_;
+
+    my $code = delete($args{'do'});
+    if (! defined($code) || ! ref($code) || reftype($code) ne 'CODE') {
+        require Carp;
+        Carp::croak("Thread::WorkerPool->new() needs a code ref for 'do'");
+    }
+
+    my $workers = exists($args{'workers'}) ? delete($args{'workers'})
+                                           : $WORKERS;
+    if (! defined($workers) ||
+        ! looks_like_number($workers) ||
+        (int($workers) != $workers) ||
+        ($workers < 1))
+    {
+        require Carp;
+        $workers = 'undef' if (! defined($workers));
+        Carp::croak("Invalid 'workers' argument ($workers) to 'new' method");
+    }
+
+    if (my @bad = sort(keys(%args))) {
+        require Carp;
+        Carp::croak("Unknown argument(s) to 'new' method: @bad");
+    }
+
+    my $self = bless({
+        'tid'     => threads->tid(),
+        'tasks'   => Thread::Queue->new(),
+        'results' => &share({}),
+        'next'    => 0,
+        'threads' => [],
+    }, $class);
+
+    # Each worker is cloned from this interpreter once, here, rather than
+    # once per task
+    for (1..$workers) {
+        my $thr = threads->create({'context' => 'list'},
+                                  \&_worker,
+                                  $self->{'tasks'}, $self->{'results'}, $code);
+        if (! defined($thr)) {
+            my $err = $!;
+            $self->shutdown();
+            require Carp;
+            Carp::croak("Can't create worker thread: $err");
+        }
+        push(@{$self->{'threads'}}, $thr);
+    }
+
+    weaken($POOLS{refaddr($self)} = $self);
+    return ($self);
+}
+
+# Number of worker threads
+sub workers
+{
+    my $self = shift;
+    return (scalar(@{$self->{'threads'}}));
+}
+
+# Queue a task, and return a future for its result
+sub submit
+{
+    my $self = shift;
+
+    if (! $self->{'threads'} || ! @{$self->{'threads'}}) {
+        require Carp;
+        Carp::croak("Can't submit to a pool that has been shut down");
+    }
+
+    my $id = ++$self->{'next'};
+
+    # The arguments travel as one frozen string, rather than as a
+    # structure that threads::shared would have to clone element by element
+    $self->{'tasks'}->enqueue($id, Storable::freeze(\@_));
+
+    return (bless({
+        'tid'     => $self->{'tid'},
+        'id'      => $id,
+        'results' => $self->{'results'},
+    }, 'Thread::WorkerPool::Future'));
+}
+
+# Let the workers finish the queued tasks, then wait for them to exit
+sub shutdown
+{
+    my $self = shift;
+
+    my $threads = delete($self->{'threads'}) or return;
+
+    # One end marker (a pair of undefs) for each thread
+    $self->{'tasks'}->enqueue((undef) x (2 * @$threads));
+
+    # A worker that finishes normally returns true; one that was ended
+    # some other way, such as by threads->exit() in the code, returns
+    # nothing, and the task it was running has no result
+    my $lost = grep { ! ($_->join())[0] } @$threads;
+    if ($lost) {
+        require Carp;
+        Carp::croak("$lost worker thread(s) exited without finishing");
+    }
+    return;
+}
+
+sub DESTROY
+{
+    my $self = shift;
+
+    # Copies of the pool in other threads don't own the workers
+    return if (threads->tid() != $self->{'tid'});
+    delete($POOLS{refaddr($self)});
+    $self->shutdown();
+}
+
+END {
+    foreach my $pool (values(%POOLS)) {
+        $pool->shutdown()
+            if (defined($pool) && threads->tid() == $pool->{'tid'});
+    }
+}
+
+# Parallel versions of map and grep
+sub pmap (&@) { return (_parallel(0, @_)); }
+sub pgrep (&@) { return (_parallel(1, @_)); }
+
+
+### Internal Functions ###
+
+# Main loop of each worker thread
+sub _worker
+{
+    my ($tasks, $results, $code) = @_;
+
+    while (1) {
+        my ($id, $args) = $tasks->dequeue(2);
+        last if (! defined($id));
+
+        # The result is frozen in the same way, marked 'R', or the error
+        # is passed back as a string, marked 'E'
+        my $out;
+        if (! eval {
+                my @ret = $code->(@{Storable::thaw($args)});
+                $out = 'R' . Storable::freeze(\@ret);
+                1;
+            })
+        {
+            $out = 'E' . (defined($@) ? "$@" : 'Unknown error');
+        }
+
+        lock(%$results);
+        if (exists($results->{$id})) {
+            # The future was abandoned
+            delete($results->{$id});
+        } else {
+            $results->{$id} = $out;
+            cond_broadcast(%$results);
+        }
+    }
+    return (1);
+}
+
+
+# Split a list into one contiguous chunk per worker, map or grep the
+# chunks as the tasks of a pool, and concatenate the results in order
+sub _parallel
+{
+    my ($grep, $code) = (shift, shift);
+
+    my $count = @_;
+    my $workers = ($WORKERS < $count) ? $WORKERS : $count;
+    if ($workers < 2) {
+        return ($grep ? grep { $code->() } @_ : map { $code->() } @_);
+    }
+
+    # Each worker's clone of this interpreter already holds the list, so a
+    # task only needs the bounds of its chunk
+    my $list = \@_;
+    my $pool = Thread::WorkerPool->new(
+        'workers' => $workers,
+        'do'      => $grep ? sub { grep { $code->() } @$list[$_[0]..$_[1]] }
+                           : sub { map  { $code->() } @$list[$_[0]..$_[1]] });
+
+    my $size = int(($count + $workers - 1) / $workers);
+    my @futures;
+    for (my $lo = 0; $lo < $count; $lo += $size) {
+        my $hi = $lo + $size - 1;
+        $hi = $count - 1 if ($hi >= $count);
+        push(@futures, $pool->submit($lo, $hi));
+    }
+
+    # Wait for the workers before collecting the results, so that one that
+    # ends without finishing its chunk is reported rather than waited for
+    $pool->shutdown();
+
+    my (@out, $err);
+    foreach my $future (@futures) {
+        if (! eval { push(@out, $future->result()); 1 }) {
+            $err = defined($@) ? $@ : 'Unknown error' if (! defined($err));
+        }
+    }
+    die($err) if (defined($err));
+    return (@out);
+}
+
+
+package Thread::WorkerPool::Future;
+
+use threads::shared 1.21;
+
+# Check whether the result is available without blocking
+sub ready
+{
+    my $self = shift;
+    return (1) if (exists($self->{'out'}));
+    my $results = $self->{'results'};
+    lock(%$results);
+    return (exists($results->{$self->{'id'}}) ? 1 : 0);
+}
+
+# Wait for the task to complete, and return its result
+sub result
+{
+    my $self = shift;
+
+    if (! exists($self->{'out'})) {
+        my $results = $self->{'results'};
+        my $id = $self->{'id'};
+        lock(%$results);
+        cond_wait(%$results) until (exists($results->{$id}));
+        $self->{'out'} = delete($results->{$id});
+    }
+
+    my $out = $self->{'out'};
+    die(substr($out, 1)) if (substr($out, 0, 1) eq 'E');
+
+    my $ret = Storable::thaw(substr($out, 1));
+    return (wantarray ? @$ret : $$ret[0]);
+}
+
+sub DESTROY
+{
+    my $self = shift;
+
+    return if (exists($self->{'out'}) || threads->tid() != $self->{'tid'});
+
+    # Drop the result if it is already there, or else tell the worker
+    # not to store it
+    my $results = $self->{'results'};
+    lock(%$results);
+    if (exists($results->{$self->{'id'}})) {
+        delete($results->{$self->{'id'}});
+    } else {
+        $results->{$self->{'id'}} = undef;
+    }
+}
+
+1;
+
+=head1 NAME
+
+Thread::WorkerPool - Pools of worker threads
+
+=head1 VERSION
+
+This document describes Thread::WorkerPool version 0.02
+
+=head1 SYNOPSIS
+
+    use strict;
+    use warnings;
+
+    use threads;
+    use Thread::WorkerPool;
+
+    # Four threads, each running the same code for every task
+    my $pool = Thread::WorkerPool->new('workers' => 4,
+                                 'do'      => sub { my ($n) = @_;
+                                                    return (fib($n)); });
+
+    # Queue the tasks
+    my @futures = map { $pool->submit($_) } 20..30;
+
+    # Collect the results
+    for my $future (@futures) {
+        print($future->result(), "\n");
+    }
+
+    # Check for completion without waiting
+    my $future = $pool->submit(35);
+    do_something_else() until $future->ready();
+
+    # Finish the queued tasks and wait for the workers to exit
+    $pool->shutdown();
+
+    # Parallel map and grep
+    use Thread::WorkerPool qw(pmap pgrep);
+
+    my @squares = pmap { $_ * $_ } @numbers;
+    my @primes  = pgrep { is_prime($_) } @numbers;
+
+=head1 DESCRIPTION
+
+Creating a thread clones the whole interpreter that creates it, which takes
+far longer than most small tasks take to run.  A pool creates its worker
+threads once, up front, and then hands them any number of tasks.
+
+Every worker runs the same code, given to C<new>.  The code is called with
+the arguments of a task, and its return values become the result of the
+task.  Because each worker has its own copy of the interpreter as it was
+when the pool was created, the code, and anything it refers to, must be
+set up before the pool is created.
+
+Task arguments and results are copied between threads with
+L<Storable/freeze>, so they can be any data Storable handles, such as
+scalars and nested arrays and hashes, but not code refs or filehandles.
+Changes the code makes to its arguments are not seen by the caller.
+
+=over
+
+=item ->new('do' => CODE)
+
+=item ->new('do' => CODE, 'workers' => COUNT)
+
+Creates a pool of COUNT worker threads (4 by default), each of which calls
+CODE for the tasks it is given.
+
+=item ->submit(ARGS)
+
+Queues a task, which will call the pool's code with the given arguments,
+and returns a future for its result (see below).  Tasks are started in the
+order they are submitted, by whichever worker becomes free first.
+
+=item ->workers()
+
+Returns the number of worker threads.
+
+=item ->shutdown()
+
+Waits for all the tasks that have been submitted to be run, and then for
+the worker threads to exit.  No more tasks may be submitted afterwards.
+This is done automatically when the pool is destroyed.
+
+If a worker thread ended without finishing, such as by the code calling
+C<threads-E<gt>exit()>, C<shutdown> dies once all the workers have been
+joined.  The task that worker was running has no result.
+
+=back
+
+=head2 Futures
+
+=over
+
+=item ->result()
+
+Waits for the task to finish and returns the values the code returned,
+called in list context.  In scalar context, the first value is returned.
+If the code died, C<result> dies with the same message.
+
+=item ->ready()
+
+Returns true if the task has finished, so that C<result> will not block.
+
+=back
+
+A future whose result is never collected does not keep the result around
+once the future is destroyed.
+
+=head2 Parallel map and grep
+
+=over
+
+=item pmap BLOCK LIST
+
+=item pgrep BLOCK LIST
+
+These work like C<map> and C<grep>, but split LIST into one contiguous
+chunk per thread and process the chunks in parallel.  The results are
+returned in the same order as C<map> and C<grep> would return them.  If
+BLOCK dies for any item, C<pmap> or C<pgrep> dies with the same message
+once all the threads have finished.
+
+Each call runs the chunks as the tasks of a pool of
+C<$Thread::WorkerPool::WORKERS> threads (4 by default, and also the
+default for C<new>) whose code is BLOCK.  The pool is created for the
+call, since its threads need a copy of BLOCK, so this only pays off when
+BLOCK does a lot of work in total: creating each thread clones the whole
+interpreter.  A list of fewer than two items is processed in the calling
+thread.
+
+Each thread works on its own copy of LIST, made when it is created, so
+changing C<$_> has no effect on LIST, and items of any kind, such as code
+references and globs, can be processed.  The results are copied back
+with Storable, like those of any task.
+
+These functions are not exported by default.
+
+=back
+
+=head1 NOTES
+
+Pools and futures belong to the thread that created them.  Copies of them
+that end up in other threads can't be used there.
+
+All the workers take their tasks from one queue.  Each task costs a few
+locks on that queue, so tasks should do enough work to make that
+worthwhile; pass a batch of items rather than one item per task.
+
+=head1 SEE ALSO
+
+L<threads>, L<threads::shared>, L<Thread::Queue>, L<Storable>
+
+=cut
@@ -0,0 +1,86 @@
+use strict;
+use warnings;
+
+BEGIN {
+    use Config;
+    if (! $Config{'useithreads'}) {
+        print("1..0 # SKIP Perl not compiled with 'useithreads'\n");
+        exit(0);
+    }
+}
+
+use threads;
+use Thread::WorkerPool;
+
+use Test::More 'tests' => 21;
+
+### Basic usage ###
+
+my $offset = 100;   # Seen by the workers as it was when they were created
+my $pool = Thread::WorkerPool->new('workers' => 3,
+                             'do'      => sub { return ($_[0] + $offset); });
+ok($pool, 'New pool');
+isa_ok($pool, 'Thread::WorkerPool');
+is($pool->workers(), 3, 'Worker count');
+is(scalar(threads->list()), 3, 'Worker threads running');
+
+my @futures = map { $pool->submit($_) } 1..50;
+isa_ok($futures[0], 'Thread::WorkerPool::Future');
+is_deeply([ map { $_->result() } @futures ], [ 101..150 ],
+          'Results in submission order');
+ok($futures[0]->ready(), 'Collected future is ready');
+is($futures[0]->result(), 101, 'Result can be collected again');
+
+my $future = $pool->submit(5);
+1 until $future->ready();
+is($future->result(), 105, 'Result after polling');
+
+$pool->shutdown();
+is(scalar(threads->list()), 0, 'Workers gone after shutdown');
+eval { $pool->submit(1); };
+like($@, qr/shut down/, 'No submit after shutdown');
+
+### Lists, structures and errors ###
+
+$pool = Thread::WorkerPool->new('workers' => 2,
+                          'do' => sub {
+                              my ($what, @args) = @_;
+                              die("Oops\n") if ($what eq 'die');
+                              return (reverse(@args)) if ($what eq 'list');
+                              $args[0]{'sum'} += $_ foreach @{$args[0]{'nums'}};
+                              return ($args[0]);
+                          });
+
+my @list = $pool->submit('list', 1, 2, 3)->result();
+is_deeply(\@list, [3, 2, 1], 'List result');
+is(scalar($pool->submit('list', 1, 2, 3)->result()), 3,
+   'First value in scalar context');
+
+my $data = { 'nums' => [ 1..10 ] };
+my $out = $pool->submit('sum', $data)->result();
+is($out->{'sum'}, 55, 'Structure passed both ways');
+ok(! exists($data->{'sum'}), 'Caller sees a copy');
+
+$future = $pool->submit('die');
+eval { $future->result(); };
+is($@, "Oops\n", 'Error passed back');
+eval { $future->result(); };
+is($@, "Oops\n", 'Error passed back again');
+is_deeply([ $pool->submit('list', 'ok')->result() ], [ 'ok' ],
+          'Pool works after error');
+
+# Abandoned results don't linger
+$pool->submit('list', $_) foreach 1..10;
+$pool->shutdown();
+is(scalar(keys(%{$pool->{'results'}})), 0, 'Abandoned results dropped');
+
+### Errors ###
+
+eval { Thread::WorkerPool->new('workers' => 2); };
+like($@, qr/code ref/, 'Needs code');
+eval { Thread::WorkerPool->new('do' => sub {}, 'workers' => 0); };
+like($@, qr/Invalid 'workers'/, 'Needs workers');
+
+exit(0);
+
+# EOF
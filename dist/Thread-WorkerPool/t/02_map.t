@@ -0,0 +1,62 @@
+use strict;
+use warnings;
+
+BEGIN {
+    use Config;
+    if (! $Config{'useithreads'}) {
+        print("1..0 # SKIP Perl not compiled with 'useithreads'\n");
+        exit(0);
+    }
+}
+
+use threads;
+use Thread::WorkerPool qw(pmap pgrep);
+
+use Test::More 'tests' => 17;
+
+my @nums = (1..1001);
+
+is_deeply([ pmap { $_ * 2 } @nums ], [ map { $_ * 2 } @nums ], 'pmap');
+is_deeply([ pgrep { $_ % 7 == 0 } @nums ], [ grep { $_ % 7 == 0 } @nums ],
+          'pgrep');
+is_deeply([ pmap { ($_, -$_) } 1..5 ], [ map { ($_, -$_) } 1..5 ],
+          'pmap with several results per item');
+is_deeply([ pmap { () } @nums ], [], 'pmap with no results');
+is(scalar(pmap { ($_, $_) } @nums), 2 * @nums, 'pmap in scalar context');
+is(scalar(pgrep { $_ > 1000 } @nums), 1, 'pgrep in scalar context');
+is(scalar(threads->list()), 0, 'No threads left behind');
+
+is_deeply([ pmap { $_ + 1 } () ], [], 'Empty list');
+is_deeply([ pmap { $_ + 1 } 41 ], [ 42 ], 'Single item');
+
+my $factor = 3;
+is_deeply([ pmap { { 'n' => $_ * $factor } } 1..4 ],
+          [ map { { 'n' => $_ * 3 } } 1..4 ], 'Closures and structures');
+
+{
+    local $Thread::WorkerPool::WORKERS = 3;
+    my @tids = pmap { threads->tid() } 1..9;
+    my %seen;
+    $seen{$_}++ foreach @tids;
+    ok(! exists($seen{threads->tid()}), 'Work is done in the workers');
+    ok(keys(%seen) >= 1 && keys(%seen) <= 3, 'No more workers than WORKERS');
+}
+
+is_deeply([ pmap { ref($_) } (sub { 1 }, \*STDOUT, [], {}) ],
+          [ 'CODE', 'GLOB', 'ARRAY', 'HASH' ], 'Items of any kind');
+
+my @orig = (1..10);
+my @copy = pmap { $_++ } @orig;
+is_deeply(\@orig, [ 1..10 ], 'List is not modified');
+
+eval { my @r = pmap { die("Bad $_\n") if ($_ == 500); $_ } @nums; };
+is($@, "Bad 500\n", 'Errors propagate');
+
+eval { my @r = pmap { threads->exit() if ($_ == 500); $_ } @nums; };
+like($@, qr/^1 worker thread\(s\) exited without finishing/,
+     'A worker that exits is reported');
+is(scalar(threads->list()), 0, '... and joined');
+
+exit(0);
+
+# EOF
@@ -7,7 +7,7 @@ use warnings;
 
 use Scalar::Util qw(reftype refaddr blessed);
 
-our $VERSION = '1.33_01';
+our $VERSION = '1.33_02';
 my $XS_VERSION = $VERSION;
 $VERSION = eval $VERSION;
 
@@ -499,6 +499,14 @@ If you want access to threads, you must C<use threads> before you
 C<use threads::shared>.  L<threads> will emit a warning if you use it after
 L<threads::shared>.
 
+All shared data lives in a single, separate interpreter, and each read or
+write of a shared variable briefly takes a lock on all of it.  Threads that
+access shared variables very heavily will therefore spend time waiting for
+each other even when they use unrelated variables; it is usually better to
+work on private copies and share only the results.  The locks taken by
+C<lock> and used by the C<cond_*> functions are separate for each variable,
+so threads locking different variables do not wait for each other.
+
 =head1 BUGS AND LIMITATIONS
 
 When C<share> is used on arrays, hashes, array refs or hash refs, any data
@@ -177,8 +177,6 @@ typedef struct {
 #endif
 } recursive_lock_t;
 
-recursive_lock_t PL_sharedsv_lock;   /* Mutex protecting the shared sv space */
-
 void
 recursive_lock_init(pTHX_ recursive_lock_t *lock)
 {
@@ -233,10 +231,52 @@ recursive_lock_acquire(pTHX_ recursive_lock_t *lock, char *file, int line)
     SAVEDESTRUCTOR_X(recursive_lock_release,lock);
 }
 
+/*
+ * The lock on the shared space itself is taken for every access to a
+ * shared variable, so it is kept cheap: the mutex is simply held for as
+ * long as the space is in use, and only the owning thread ever looks at
+ * or changes the recursion count.  Unlike a recursive_lock_t, taking and
+ * releasing it costs one mutex operation each, and a waiting thread is
+ * woken by the mutex rather than by a condition variable.
+ */
+
+typedef struct {
+    perl_mutex          mutex;
+    PerlInterpreter    *owner;
+    I32                 locks;
+} space_lock_t;
+
+space_lock_t PL_sharedsv_lock;       /* Mutex protecting the shared sv space */
+
+void
+space_lock_release(pTHX_ space_lock_t *lock)
+{
+    assert(lock->owner == aTHX);
+    if (--lock->locks == 0) {
+        lock->owner = NULL;
+        MUTEX_UNLOCK(&lock->mutex);
+    }
+}
+
+void
+space_lock_acquire(pTHX_ space_lock_t *lock)
+{
+    assert(aTHX);
+    /* Only this thread can have made itself the owner */
+    if (lock->owner == aTHX) {
+        lock->locks++;
+    } else {
+        MUTEX_LOCK(&lock->mutex);
+        lock->owner = aTHX;
+        lock->locks = 1;
+    }
+    SAVEDESTRUCTOR_X(space_lock_release, lock);
+}
+
 #define ENTER_LOCK                                                          \
     STMT_START {                                                            \
         ENTER;                                                              \
-        recursive_lock_acquire(aTHX_ &PL_sharedsv_lock, __FILE__, __LINE__);\
+        space_lock_acquire(aTHX_ &PL_sharedsv_lock);                        \
     } STMT_END
 
 /* The unlocking is done automatically at scope exit */
@@ -263,11 +303,32 @@ recursive_lock_acquire(pTHX_ recursive_lock_t *lock, char *file, int line)
    is used by user-level locking or condition code
 */
 
-typedef struct {
+typedef struct user_lock {
     recursive_lock_t    lock;           /* For user-levl locks */
     perl_cond           user_cond;      /* For user-level conditions */
+    SV                 *ssv;            /* The shared SV it belongs to */
+    struct user_lock   *next;           /* Next in the same stripe */
 } user_lock;
 
+/* User locks are also entered in a table keyed on the address of their
+   shared SV, so that lock() and the cond_*() functions can find them
+   without taking the lock on the whole shared space.  The table is split
+   into stripes, each with its own mutex, so threads locking unrelated
+   variables rarely contend.  A stripe mutex is never held while taking
+   any other lock.
+ */
+
+#define UL_STRIPES      64              /* Must be a power of 2 */
+#define UL_STRIPE(ssv)  \
+    (&PL_sharedsv_userlocks[(PTR2UV(ssv) >> 4) & (UL_STRIPES - 1)])
+
+typedef struct {
+    perl_mutex          mutex;
+    user_lock          *head;
+} user_lock_stripe;
+
+user_lock_stripe PL_sharedsv_userlocks[UL_STRIPES];
+
 /* Magic used for attaching user_lock structs to shared SVs
 
    The vtable used has just one entry - when the SV goes away
@@ -280,6 +341,13 @@ sharedsv_userlock_free(pTHX_ SV *sv, MAGIC *mg)
     user_lock *ul = (user_lock *) mg->mg_ptr;
     assert(aTHX == PL_sharedsv_space);
     if (ul) {
+        user_lock_stripe *stripe = UL_STRIPE(ul->ssv);
+        user_lock **ulp;
+        MUTEX_LOCK(&stripe->mutex);
+        for (ulp = &stripe->head; *ulp != ul; ulp = &(*ulp)->next)
+            assert(*ulp);
+        *ulp = ul->next;
+        MUTEX_UNLOCK(&stripe->mutex);
         recursive_lock_destroy(aTHX_ &ul->lock);
         COND_DESTROY(&ul->user_cond);
         PerlMemShared_free(ul);
@@ -333,30 +401,34 @@ S_sharedsv_from_obj(pTHX_ SV *sv)
 /* Return the user_lock structure (if any) associated with a shared SV.
  * If create is true, create one if it doesn't exist
  */
+STATIC user_lock *
+S_find_userlock(user_lock_stripe *stripe, SV *ssv)
+{
+    user_lock *ul;
+    MUTEX_LOCK(&stripe->mutex);
+    for (ul = stripe->head; ul && ul->ssv != ssv; ul = ul->next) ;
+    MUTEX_UNLOCK(&stripe->mutex);
+    return (ul);
+}
+
 STATIC user_lock *
 S_get_userlock(pTHX_ SV* ssv, bool create)
 {
-    MAGIC *mg;
-    user_lock *ul = NULL;
+    user_lock_stripe *stripe = UL_STRIPE(ssv);
+    user_lock *ul;
 
     assert(ssv);
-    /* XXX Redesign the storage of user locks so we don't need a global
-     * lock to access them ???? DAPM */
-    ENTER_LOCK;
-
-    /* Version of mg_find that also checks the private signature */
-    for (mg = SvMAGIC(ssv); mg; mg = mg->mg_moremagic) {
-        if ((mg->mg_type == PERL_MAGIC_ext) &&
-            (mg->mg_private == UL_MAGIC_SIG))
-        {
-            break;
-        }
-    }
+    ul = S_find_userlock(stripe, ssv);
+    if (ul || !create)
+        return (ul);
 
-    if (mg) {
-        ul = (user_lock*)(mg->mg_ptr);
-    } else if (create) {
+    /* Adding the magic changes the shared SV */
+    ENTER_LOCK;
+    /* Another thread may have created it in the meantime */
+    ul = S_find_userlock(stripe, ssv);
+    if (! ul) {
         dTHXc;
+        MAGIC *mg;
         SHARED_CONTEXT;
         ul = (user_lock *) PerlMemShared_malloc(sizeof(user_lock));
         Zero(ul, 1, user_lock);
@@ -366,7 +438,12 @@ S_get_userlock(pTHX_ SV* ssv, bool create)
         mg->mg_private = UL_MAGIC_SIG;  /* Set private signature */
         recursive_lock_init(aTHX_ &ul->lock);
         COND_INIT(&ul->user_cond);
+        ul->ssv = ssv;
         CALLER_CONTEXT;
+        MUTEX_LOCK(&stripe->mutex);
+        ul->next = stripe->head;
+        stripe->head = ul;
+        MUTEX_UNLOCK(&stripe->mutex);
     }
     LEAVE_LOCK;
     return (ul);
@@ -700,6 +777,34 @@ S_get_RV(pTHX_ SV *sv, SV *ssv) {
 }
 
 
+/* Return a mortal copy of the value of a shared SV that has just been
+ * removed from its aggregate, and drop the aggregate's reference to it.
+ * Perl copies whatever a tied POP or SHIFT returns, so there is no need
+ * to hand back a proxy and fetch the value through it.
+ * Assumes lock is held.
+ */
+STATIC SV *
+S_sharedsv_take(pTHX_ SV *ssv)
+{
+    SV *sv = sv_newmortal();
+
+    assert(PL_sharedsv_lock.owner == aTHX);
+    if (SvROK(ssv)) {
+        SvUPGRADE(sv, SVt_RV);
+        S_get_RV(aTHX_ sv, ssv);
+        /* Look ahead for refs of refs */
+        if (SvROK(SvRV(ssv))) {
+            SvROK_on(SvRV(sv));
+            S_get_RV(aTHX_ SvRV(sv), SvRV(ssv));
+        }
+    } else {
+        sv_setsv_nomg(sv, ssv);
+    }
+    S_sharedsv_dec(aTHX_ ssv);
+    return (sv);
+}
+
+
 /* ------------ PERL_MAGIC_shared_scalar(n) functions -------------- */
 
 /* Get magic for PERL_MAGIC_shared_scalar(n) */
@@ -1175,11 +1280,8 @@ STATIC despatch_signals_proc_t prev_signal_hook = NULL;
 
 STATIC void
 S_shared_signal_hook(pTHX) {
-    int us;
-    MUTEX_LOCK(&PL_sharedsv_lock.mutex);
-    us = (PL_sharedsv_lock.owner == aTHX);
-    MUTEX_UNLOCK(&PL_sharedsv_lock.mutex);
-    if (us)
+    /* Only this thread can have made itself the owner */
+    if (PL_sharedsv_lock.owner == aTHX)
 	return; /* try again later */
     CALL_FPTR(prev_signal_hook)(aTHX);
 }
@@ -1195,7 +1297,15 @@ Perl_sharedsv_init(pTHX)
     PL_sharedsv_space = perl_alloc();
     perl_construct(PL_sharedsv_space);
     CALLER_CONTEXT;
-    recursive_lock_init(aTHX_ &PL_sharedsv_lock);
+    {
+        int i;
+        Zero(&PL_sharedsv_lock, 1, space_lock_t);
+        MUTEX_INIT(&PL_sharedsv_lock.mutex);
+        for (i = 0; i < UL_STRIPES; i++) {
+            MUTEX_INIT(&PL_sharedsv_userlocks[i].mutex);
+            PL_sharedsv_userlocks[i].head = NULL;
+        }
+    }
     PL_lockhook = &Perl_sharedsv_locksv;
     PL_sharehook = &Perl_sharedsv_share;
 #ifdef PL_destroyhook
@@ -1223,18 +1333,20 @@ PUSH(SV *obj, ...)
         dTHXc;
         SV *sobj = S_sharedsv_from_obj(aTHX_ obj);
         int i;
+        /* Copy the values before taking the lock: fetching them may run
+         * tie or overload code, which must not run while it is held */
+        for (i = 1; i < items; i++)
+            ST(i) = sv_mortalcopy(ST(i));
+        ENTER_LOCK;
         for (i = 1; i < items; i++) {
-            SV* tmp = newSVsv(ST(i));
-            SV *stmp;
-            ENTER_LOCK;
-            stmp = S_sharedsv_new_shared(aTHX_ tmp);
-            sharedsv_scalar_store(aTHX_ tmp, stmp);
+            SV *stmp = S_sharedsv_new_shared(aTHX_ ST(i));
+            sharedsv_scalar_store(aTHX_ ST(i), stmp);
             SHARED_CONTEXT;
             av_push((AV*) sobj, stmp);
             SvREFCNT_inc_void(stmp);
-            SHARED_RELEASE;
-            SvREFCNT_dec(tmp);
+            CALLER_CONTEXT;
         }
+        LEAVE_LOCK;
 
 
 void
@@ -1243,19 +1355,20 @@ UNSHIFT(SV *obj, ...)
         dTHXc;
         SV *sobj = S_sharedsv_from_obj(aTHX_ obj);
         int i;
+        /* As for PUSH */
+        for (i = 1; i < items; i++)
+            ST(i) = sv_mortalcopy(ST(i));
         ENTER_LOCK;
         SHARED_CONTEXT;
         av_unshift((AV*)sobj, items - 1);
         CALLER_CONTEXT;
         for (i = 1; i < items; i++) {
-            SV *tmp = newSVsv(ST(i));
-            SV *stmp = S_sharedsv_new_shared(aTHX_ tmp);
-            sharedsv_scalar_store(aTHX_ tmp, stmp);
+            SV *stmp = S_sharedsv_new_shared(aTHX_ ST(i));
+            sharedsv_scalar_store(aTHX_ ST(i), stmp);
             SHARED_CONTEXT;
             av_store((AV*) sobj, i - 1, stmp);
             SvREFCNT_inc_void(stmp);
             CALLER_CONTEXT;
-            SvREFCNT_dec(tmp);
         }
         LEAVE_LOCK;
 
@@ -1270,9 +1383,7 @@ POP(SV *obj)
         SHARED_CONTEXT;
         ssv = av_pop((AV*)sobj);
         CALLER_CONTEXT;
-        ST(0) = sv_newmortal();
-        Perl_sharedsv_associate(aTHX_ ST(0), ssv);
-        SvREFCNT_dec(ssv);
+        ST(0) = S_sharedsv_take(aTHX_ ssv);
         LEAVE_LOCK;
         /* XSRETURN(1); - implied */
 
@@ -1287,9 +1398,7 @@ SHIFT(SV *obj)
         SHARED_CONTEXT;
         ssv = av_shift((AV*)sobj);
         CALLER_CONTEXT;
-        ST(0) = sv_newmortal();
-        Perl_sharedsv_associate(aTHX_ ST(0), ssv);
-        SvREFCNT_dec(ssv);
+        ST(0) = S_sharedsv_take(aTHX_ ssv);
         LEAVE_LOCK;
         /* XSRETURN(1); - implied */
 
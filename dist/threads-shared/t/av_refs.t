@@ -27,7 +27,7 @@ sub ok {
 
 BEGIN {
     $| = 1;
-    print("1..14\n");   ### Number of tests that will be run ###
+    print("1..20\n");   ### Number of tests that will be run ###
 };
 
 use threads;
@@ -90,6 +90,34 @@ ok(13, is_shared(@av), "Check for sharing");
 my $x :shared;
 ok(14, is_shared($x), "Check for sharing");
 
+# Values shifted or popped off a shared array are copies, but refs to
+# shared data must still lead back to that data
+my $foo = bless(&share({}), 'Foo');
+$foo->{'key'} = 'value';
+my @q :shared = ($foo, \$x, 'plain');
+my $obj = shift(@q);
+ok(15, ref($obj) eq 'Foo' && $obj->{'key'} eq 'value', 'Shift blessed ref');
+ok(16, is_shared($obj), 'Shifted ref is still shared');
+ok(17, pop(@q) eq 'plain', 'Pop plain value');
+${pop(@q)} = 42;
+ok(18, $x == 42, 'Popped scalar ref points to shared scalar');
+
+# Values are fetched before the shared lock is taken, so fetching may
+# itself use shared data
+{
+    package Counter;
+    my $n :shared = 0;
+    sub TIESCALAR { bless [] }
+    sub FETCH { ++$n }
+}
+tie my $count, 'Counter';
+my @c :shared;
+push(@c, $count, $count);
+unshift(@c, $count);
+ok(19, "@c" eq '3 1 2', 'Push and unshift tied values');
+push(@c, shift(@c) + 10);
+ok(20, "@c" eq '1 2 13', 'Push a temporary');
+
 exit(0);
 
 # EOF
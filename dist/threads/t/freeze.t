@@ -0,0 +1,120 @@
+use strict;
+use warnings;
+
+BEGIN {
+    require($ENV{PERL_CORE} ? '../../t/test.pl' : './t/test.pl');
+
+    use Config;
+    if (! $Config{'useithreads'}) {
+        skip_all(q/Perl not compiled with 'useithreads'/);
+    }
+
+    plan(29);
+    watchdog(120);
+}
+
+use ExtUtils::testlib;
+
+use_ok('threads');
+
+### Start of Testing ###
+
+my %data = (
+    'str'   => 'abc',
+    'int'   => 42,
+    'num'   => '3.5',
+    'undef' => undef,
+    'list'  => [ 1, 'two', [ 3 ] ],
+    'hash'  => { 'a' => 1 },
+);
+$data{'self'} = \%data;
+
+my $table = threads->freeze(\%data);
+is(ref($table), 'HASH', 'Frozen hash');
+ok($table != \%data, 'Frozen data is a copy');
+is($table->{'list'}[2][0], 3, 'Nested data copied');
+ok($table->{'self'} == $table, 'Cycles preserved');
+
+$data{'str'} = 'changed';
+is($table->{'str'}, 'abc', 'Copy is independent of the original');
+
+ok(! eval { $table->{'str'} = 'x'; 1; }, 'Values are read-only');
+ok(! eval { push(@{$table->{'list'}}, 4); 1; }, 'Arrays are read-only');
+ok(! eval { $table->{'new'} = 1; 1; }, 'No new keys');
+ok(! eval { my $x = $table->{'none'}; 1; }, 'No fetching missing keys');
+ok(! exists($table->{'none'}), 'exists works');
+is($table->{'num'} + 1, 4.5, 'Numeric use');
+is($table->{'int'} . '', '42', 'String use');
+
+my $addr = 0 + $table;
+my $thr = threads->create(sub {
+    my $list = $table->{'list'};
+    return (join(',', 0 + $table,
+                      $$list[1],
+                      $table->{'self'}{'hash'}{'a'},
+                      scalar(keys(%$table)),
+                      eval { threads->freeze([1]); 1; } ? 'ok' : 'croak'));
+});
+my ($taddr, @got) = split(/,/, $thr->join());
+is($taddr, $addr, 'Thread sees the same data, not a copy');
+is("@got", 'two 1 7 croak', 'Thread reads the data, but cannot freeze');
+
+my @thr = map { threads->create(sub { my $n = 0;
+                                      $n += $table->{'int'} for 1..1000;
+                                      return ($n); }) } 1..3;
+is($_->join(), 42000, 'Concurrent readers') foreach @thr;
+
+# Each thread has its own iterators over frozen hashes
+my $big = threads->freeze({ map { ($_ => $_ * 2) } 1..2000 });
+my $want = join(',', sort { $a <=> $b } keys(%$big));
+keys(%$big);
+each(%$big);
+@thr = map { threads->create(sub {
+            my $bad = 0;
+            for (1..50) {
+                my @k = keys(%$big);
+                my $n = 0;
+                while (my ($k, $v) = each(%$big)) {
+                    $bad++, last if ($v != $k * 2);
+                    $n++;
+                }
+                $bad++ if ($n != 2000
+                           || join(',', sort { $a <=> $b } @k) ne $want);
+            }
+            return ($bad);
+        }) } 1..4;
+is($_->join(), 0, 'Concurrent iteration') foreach @thr;
+my $n = 1;
+$n++ while (each(%$big));
+is($n, 2000, "Threads don't disturb the creator's iterator");
+
+eval { threads->freeze([ bless({}, 'Foo') ]); };
+like($@, qr/Can't freeze blessed objects/, 'No objects');
+eval { threads->freeze({ 'code' => sub { 1 } }); };
+like($@, qr/Can't freeze CODE/, 'No code refs');
+eval { threads->freeze('data'); };
+like($@, qr/Usage/, 'Needs a reference');
+
+{
+    use Scalar::Util 'weaken';
+    my $copy = $table;
+    weaken($copy);
+    undef($table);
+    ok(defined($copy), 'References to frozen data stay strong');
+    $table = $copy;
+}
+
+# Frozen data is released by global destruction
+my $out = run_perl(prog => 'use threads 1.77_02;' .
+                           'my $t = threads->freeze({ a => [ 1, 2 ] });' .
+                           'my $u = threads->freeze([ $t, \\"x", $t ]);' .
+                           'threads->create(sub { $$u[0]{a}[1] })->join();' .
+                           'print("done\\n");',
+                   nolib => ($ENV{PERL_CORE}) ? 0 : 1,
+                   switches => ($ENV{PERL_CORE}) ? [] : [ '-Mblib' ]);
+is($out, "done\n", 'Program exits');
+is($?, 0, '... cleanly');
+
+exit(0);
+
+# EOF
@@ -5,7 +5,7 @@ use 5.008;
 use strict;
 use warnings;
 
-our $VERSION = '1.77_01';
+our $VERSION = '1.77_02';
 my $XS_VERSION = $VERSION;
 $VERSION = eval $VERSION;
 
@@ -422,6 +422,30 @@ Threads are executed in an C<eval> context.  This method will return C<undef>
 if the thread terminates I<normally>.  Otherwise, it returns the value of
 C<$@> associated with the thread's execution status in its C<eval> context.
 
+=item $ref = threads->freeze(REF)
+
+Makes a read-only copy of the scalar, array or hash that REF refers to,
+including everything it refers to in turn, and returns a reference to the
+copy.  Threads created afterwards read the copy directly, instead of each
+getting a copy of their own when they are created.  This suits large
+lookup tables that are loaded once and never changed:
+
+    my $table = threads->freeze(load_table());
+    my $thr = threads->create(sub { return ($table->{'key'}); });
+
+Every part of the copy is read-only, so trying to change it dies.  Its
+hashes are restricted (see L<Hash::Util>), so fetching a key that does not
+exist also dies: use C<exists> first.  Each thread has iterators of its
+own for the hashes, so any number of threads can go through the same hash
+with C<each>, C<keys> or C<values> at the same time.  A new thread starts
+at the beginning of each hash, wherever the thread that created it was.
+
+Only plain values and references to scalars, arrays and hashes can be
+frozen; objects, code refs and filehandles cannot.  Only the main thread
+can freeze data, and the copy is only freed when the program exits.
+References to it can't be weakened: L<Scalar::Util/weaken> silently
+leaves them strong, and C<isweak> returns false for them.
+
 =item $thr->_handle()
 
 This I<private> method returns the memory location of the internal thread
@@ -855,6 +879,17 @@ following results in the above error:
 Safe signals must be in effect to use the C<-E<gt>kill()> signalling method.
 See L</"Unsafe signals"> for more details.
 
+=item Data can only be frozen by the main thread
+
+C<threads-E<gt>freeze()> was called in a thread other than the main thread.
+
+=item Can't freeze blessed objects
+
+=item Can't freeze ...
+
+The data passed to C<threads-E<gt>freeze()> contains something other than
+plain values and references to scalars, arrays and hashes.
+
 =item Unrecognized signal name: ...
 
 The particular copy of Perl that you're trying to use does not support the
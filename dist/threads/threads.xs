@@ -1661,6 +1661,21 @@ ithread_error(...)
         /* XSRETURN(1); - implied */
 
 
+void
+ithread_freeze(...)
+    CODE:
+        /* Class method only */
+        if ((items != 2) || SvROK(ST(0)) || ! SvROK(ST(1))) {
+            Perl_croak(aTHX_ "Usage: threads->freeze(REF)");
+        }
+#ifdef SV_FROZEN_REFCNT
+        ST(0) = sv_2mortal(newRV_inc(sv_freeze(SvRV(ST(1)))));
+#else
+        Perl_croak(aTHX_ "This Perl does not support freezing data");
+#endif
+        /* XSRETURN(1); - implied */
+
+
 #endif /* USE_ITHREADS */
 
 
@@ -1257,6 +1257,94 @@ Perl_do_print(pTHX_ register SV *sv, PerlIO *fp)
     }
 }
 
+#ifdef PERLIO_LAYERS
+#  define PERL_PRINTV_MAX 16
+
+/* Hand the gathered chunks to PerlIO_writev(), coming back for whatever
+ * a short write left over. */
+STATIC bool
+S_print_iov(pTHX_ PerlIO *fp, PerlIO_iovec *iov, int iovcnt)
+{
+    while (iovcnt > 0) {
+	SSize_t count = PerlIO_writev(fp, iov, iovcnt);
+	if (count <= 0)
+	    return FALSE;
+	while (iovcnt > 0 && (Size_t)count >= iov->len) {
+	    count -= iov->len;
+	    iov++;
+	    iovcnt--;
+	}
+	if (count) {
+	    iov->base = (const char *)iov->base + count;
+	    iov->len -= count;
+	}
+    }
+    return !PerlIO_error(fp);
+}
+#endif
+
+/* Print the list of SVs from mark to sp, separated by $, if use_ofs is
+ * true.  Runs of plain strings, which can be written without any
+ * conversion or side effect, are gathered and written with a single
+ * PerlIO_writev(), so that big ones don't have to be copied through the
+ * buffer.  Returns false on the first failure. */
+
+bool
+Perl_do_printv(pTHX_ register SV **mark, register SV **sp, PerlIO *fp,
+	       bool use_ofs)
+{
+    dVAR;
+#ifdef PERLIO_LAYERS
+    PerlIO_iovec iov[PERL_PRINTV_MAX];
+    int iovcnt = 0;
+    const bool utf8 = cBOOL(PerlIO_isutf8(fp));
+#endif
+    bool sep = FALSE;
+
+    PERL_ARGS_ASSERT_DO_PRINTV;
+
+    while (mark <= sp) {
+	/* don't cache $, - it may be invalidated by magic callbacks */
+	SV * const sv = sep ? GvSV(PL_ofsgv) : *mark;
+#ifdef PERLIO_LAYERS
+	if (sv && SvPOK(sv) && !SvGMAGICAL(sv)
+	    && (utf8 ? cBOOL(SvUTF8(sv)) : !DO_UTF8(sv)))
+	{
+	    if (SvCUR(sv)) {
+		if (iovcnt == PERL_PRINTV_MAX) {
+		    if (!S_print_iov(aTHX_ fp, iov, iovcnt))
+			return FALSE;
+		    iovcnt = 0;
+		}
+		iov[iovcnt].base = SvPVX_const(sv);
+		iov[iovcnt++].len = SvCUR(sv);
+	    }
+	}
+	else {
+	    if (iovcnt) {
+		if (!S_print_iov(aTHX_ fp, iov, iovcnt))
+		    return FALSE;
+		iovcnt = 0;
+	    }
+	    if (!do_print(sv, fp))
+		return FALSE;
+	}
+#else
+	if (!do_print(sv, fp))
+	    return FALSE;
+#endif
+	if (sep)
+	    sep = FALSE;
+	else if (++mark <= sp && use_ofs)
+	    sep = TRUE;
+    }
+#ifdef PERLIO_LAYERS
+    if (iovcnt && !S_print_iov(aTHX_ fp, iov, iovcnt))
+	return FALSE;
+#endif
+    return TRUE;
+}
+
 I32
 Perl_my_stat(pTHX)
 {
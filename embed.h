@@ -69,6 +69,7 @@
 #define av_reify		Perl_av_reify
 #endif
 #define av_shift		Perl_av_shift
+#define av_shrink		Perl_av_shrink
 #define av_store		Perl_av_store
 #define av_undef		Perl_av_undef
 #define av_unshift		Perl_av_unshift
@@ -214,6 +215,7 @@
 #define do_openn		Perl_do_openn
 #ifdef PERL_CORE
 #define do_print		Perl_do_print
+#define do_printv		Perl_do_printv
 #define do_readline		Perl_do_readline
 #define do_chomp		Perl_do_chomp
 #define do_seek			Perl_do_seek
@@ -273,6 +275,9 @@
 #define getenv_len		Perl_getenv_len
 #endif
 #endif
+#ifdef PERL_CORE
+#define goto_sub		Perl_goto_sub
+#endif
 #define gp_free			Perl_gp_free
 #define gp_ref			Perl_gp_ref
 #define gv_add_by_type		Perl_gv_add_by_type
@@ -286,6 +291,10 @@
 #define gv_fetchmeth_autoload	Perl_gv_fetchmeth_autoload
 #define gv_fetchmethod_autoload	Perl_gv_fetchmethod_autoload
 #define gv_fetchmethod_flags	Perl_gv_fetchmethod_flags
+#ifdef PERL_CORE
+#define method_cache_fetch	Perl_method_cache_fetch
+#define method_cache_store	Perl_method_cache_store
+#endif
 #define gv_fetchpv		Perl_gv_fetchpv
 #define gv_fullname		Perl_gv_fullname
 #define gv_fullname4		Perl_gv_fullname4
@@ -413,6 +422,7 @@
 #ifdef PERL_CORE
 #define opt_scalarhv		S_opt_scalarhv
 #define is_inplace_av		S_is_inplace_av
+#define is_args_aassign		S_is_args_aassign
 #endif
 #endif
 #define leave_scope		Perl_leave_scope
@@ -472,6 +482,14 @@
 #define magic_clearsig		Perl_magic_clearsig
 #define magic_existspack	Perl_magic_existspack
 #define magic_freeovrld		Perl_magic_freeovrld
+#define magic_freemethcache	Perl_magic_freemethcache
+#endif
+#if defined(USE_ITHREADS)
+#ifdef PERL_CORE
+#define magic_dupmethcache	Perl_magic_dupmethcache
+#endif
+#endif
+#ifdef PERL_CORE
 #define magic_get		Perl_magic_get
 #define magic_getarylen		Perl_magic_getarylen
 #define magic_getdefelem	Perl_magic_getdefelem
@@ -943,6 +961,7 @@
 #ifdef PERL_CORE
 #define sv_clean_all		Perl_sv_clean_all
 #define sv_clean_objs		Perl_sv_clean_objs
+#define sv_clean_frozen		Perl_sv_clean_frozen
 #endif
 #define sv_clear		Perl_sv_clear
 #define sv_cmp			Perl_sv_cmp
@@ -1244,6 +1263,7 @@
 #define share_hek_flags		S_share_hek_flags
 #define hv_notallowed		S_hv_notallowed
 #define hv_auxinit		S_hv_auxinit
+#define hv_iter_aux		S_hv_iter_aux
 #define hv_delete_common	S_hv_delete_common
 #define clear_placeholders	S_clear_placeholders
 #define refcounted_he_value	S_refcounted_he_value
@@ -1327,6 +1347,11 @@
 #define no_fh_allowed		S_no_fh_allowed
 #define too_few_arguments	S_too_few_arguments
 #define too_many_arguments	S_too_many_arguments
+#define inline_sub		S_inline_sub
+#define inline_cop		S_inline_cop
+#define inline_expr		S_inline_expr
+#define inline_arg		S_inline_arg
+#define tailcalls_enabled	S_tailcalls_enabled
 #define looks_like_bool		S_looks_like_bool
 #define newGIVWHENOP		S_newGIVWHENOP
 #define ref_array_or_hash	S_ref_array_or_hash
@@ -1427,6 +1452,8 @@
 #if defined(PERL_IN_PP_HOT_C) || defined(PERL_DECL_PROT)
 #ifdef PERL_CORE
 #define do_oddball		S_do_oddball
+#define aassign_args		S_aassign_args
+#define tail_call		S_tail_call
 #define method_common		S_method_common
 #endif
 #endif
@@ -1603,6 +1630,8 @@
 #define glob_assign_glob	S_glob_assign_glob
 #define glob_assign_ref		S_glob_assign_ref
 #define ptr_table_find		S_ptr_table_find
+#define sv_freeze_copy		S_sv_freeze_copy
+#define sv_freeze_free_seen	S_sv_freeze_free_seen
 #endif
 #endif
 #if defined(PERL_IN_TOKE_C) || defined(PERL_DECL_PROT)
@@ -1712,6 +1741,7 @@
 #define sv_utf8_upgrade_flags_grow	Perl_sv_utf8_upgrade_flags_grow
 #define sv_pvn_force_flags	Perl_sv_pvn_force_flags
 #define sv_copypv		Perl_sv_copypv
+#define sv_freeze		Perl_sv_freeze
 #define my_atof2		Perl_my_atof2
 #define my_socketpair		Perl_my_socketpair
 #define my_dirfd		Perl_my_dirfd
@@ -1733,6 +1763,8 @@
 #define PerlIO_setlinebuf	Perl_PerlIO_setlinebuf
 #define PerlIO_read		Perl_PerlIO_read
 #define PerlIO_write		Perl_PerlIO_write
+#define PerlIO_writev		Perl_PerlIO_writev
+#define PerlIO_copy		Perl_PerlIO_copy
 #define PerlIO_unread		Perl_PerlIO_unread
 #define PerlIO_tell		Perl_PerlIO_tell
 #define PerlIO_seek		Perl_PerlIO_seek
@@ -2051,6 +2083,13 @@
 #define mro_isa_changed_in	Perl_mro_isa_changed_in
 #endif
 #define mro_method_changed_in	Perl_mro_method_changed_in
+#define gv_method_changed	Perl_gv_method_changed
+#if defined(PERL_IN_MRO_C) || defined(PERL_DECL_PROT)
+#ifdef PERL_CORE
+#define mro_method_changed	S_mro_method_changed
+#define mro_overloaded		S_mro_overloaded
+#endif
+#endif
 #ifdef PERL_CORE
 #define boot_core_mro		Perl_boot_core_mro
 #endif
@@ -2270,6 +2309,7 @@
 #define pp_i_negate		Perl_pp_i_negate
 #define pp_i_subtract		Perl_pp_i_subtract
 #define pp_index		Perl_pp_index
+#define pp_inlinesub		Perl_pp_inlinesub
 #define pp_int			Perl_pp_int
 #define pp_ioctl		Perl_pp_ioctl
 #define pp_iter			Perl_pp_iter
@@ -2511,6 +2551,7 @@
 #define av_reify(a)		Perl_av_reify(aTHX_ a)
 #endif
 #define av_shift(a)		Perl_av_shift(aTHX_ a)
+#define av_shrink(a)		Perl_av_shrink(aTHX_ a)
 #define av_store(a,b,c)		Perl_av_store(aTHX_ a,b,c)
 #define av_undef(a)		Perl_av_undef(aTHX_ a)
 #define av_unshift(a,b)		Perl_av_unshift(aTHX_ a,b)
@@ -2640,6 +2681,7 @@
 #define do_openn(a,b,c,d,e,f,g,h,i)	Perl_do_openn(aTHX_ a,b,c,d,e,f,g,h,i)
 #ifdef PERL_CORE
 #define do_print(a,b)		Perl_do_print(aTHX_ a,b)
+#define do_printv(a,b,c,d)	Perl_do_printv(aTHX_ a,b,c,d)
 #define do_readline()		Perl_do_readline(aTHX)
 #define do_chomp(a)		Perl_do_chomp(aTHX_ a)
 #define do_seek(a,b,c)		Perl_do_seek(aTHX_ a,b,c)
@@ -2699,6 +2741,7 @@
 #endif
 #endif
 #ifdef PERL_CORE
+#define goto_sub(a)		Perl_goto_sub(aTHX_ a)
 #endif
 #define gp_free(a)		Perl_gp_free(aTHX_ a)
 #define gp_ref(a)		Perl_gp_ref(aTHX_ a)
@@ -2713,6 +2756,10 @@
 #define gv_fetchmeth_autoload(a,b,c,d)	Perl_gv_fetchmeth_autoload(aTHX_ a,b,c,d)
 #define gv_fetchmethod_autoload(a,b,c)	Perl_gv_fetchmethod_autoload(aTHX_ a,b,c)
 #define gv_fetchmethod_flags(a,b,c)	Perl_gv_fetchmethod_flags(aTHX_ a,b,c)
+#ifdef PERL_CORE
+#define method_cache_fetch(a,b)	Perl_method_cache_fetch(aTHX_ a,b)
+#define method_cache_store(a,b,c)	Perl_method_cache_store(aTHX_ a,b,c)
+#endif
 #define gv_fetchpv(a,b,c)	Perl_gv_fetchpv(aTHX_ a,b,c)
 #define gv_fullname(a,b)	Perl_gv_fullname(aTHX_ a,b)
 #define gv_fullname4(a,b,c,d)	Perl_gv_fullname4(aTHX_ a,b,c,d)
@@ -2850,6 +2897,7 @@
 #ifdef PERL_CORE
 #define opt_scalarhv(a)		S_opt_scalarhv(aTHX_ a)
 #define is_inplace_av(a,b)	S_is_inplace_av(aTHX_ a,b)
+#define is_args_aassign(a)	S_is_args_aassign(aTHX_ a)
 #endif
 #endif
 #define leave_scope(a)		Perl_leave_scope(aTHX_ a)
@@ -2908,6 +2956,14 @@
 #define magic_clearsig(a,b)	Perl_magic_clearsig(aTHX_ a,b)
 #define magic_existspack(a,b)	Perl_magic_existspack(aTHX_ a,b)
 #define magic_freeovrld(a,b)	Perl_magic_freeovrld(aTHX_ a,b)
+#define magic_freemethcache(a,b)	Perl_magic_freemethcache(aTHX_ a,b)
+#endif
+#if defined(USE_ITHREADS)
+#ifdef PERL_CORE
+#define magic_dupmethcache(a,b)	Perl_magic_dupmethcache(aTHX_ a,b)
+#endif
+#endif
+#ifdef PERL_CORE
 #define magic_get(a,b)		Perl_magic_get(aTHX_ a,b)
 #define magic_getarylen(a,b)	Perl_magic_getarylen(aTHX_ a,b)
 #define magic_getdefelem(a,b)	Perl_magic_getdefelem(aTHX_ a,b)
@@ -3379,6 +3435,7 @@
 #ifdef PERL_CORE
 #define sv_clean_all()		Perl_sv_clean_all(aTHX)
 #define sv_clean_objs()		Perl_sv_clean_objs(aTHX)
+#define sv_clean_frozen()	Perl_sv_clean_frozen(aTHX)
 #endif
 #define sv_clear(a)		Perl_sv_clear(aTHX_ a)
 #define sv_cmp(a,b)		Perl_sv_cmp(aTHX_ a,b)
@@ -3674,6 +3731,7 @@
 #define share_hek_flags(a,b,c,d)	S_share_hek_flags(aTHX_ a,b,c,d)
 #define hv_notallowed(a,b,c,d)	S_hv_notallowed(aTHX_ a,b,c,d)
 #define hv_auxinit		S_hv_auxinit
+#define hv_iter_aux(a)		S_hv_iter_aux(aTHX_ a)
 #define hv_delete_common(a,b,c,d,e,f,g)	S_hv_delete_common(aTHX_ a,b,c,d,e,f,g)
 #define clear_placeholders(a,b)	S_clear_placeholders(aTHX_ a,b)
 #define refcounted_he_value(a)	S_refcounted_he_value(aTHX_ a)
@@ -3761,6 +3819,11 @@
 #define no_fh_allowed(a)	S_no_fh_allowed(aTHX_ a)
 #define too_few_arguments(a,b)	S_too_few_arguments(aTHX_ a,b)
 #define too_many_arguments(a,b)	S_too_many_arguments(aTHX_ a,b)
+#define inline_sub(a,b)		S_inline_sub(aTHX_ a,b)
+#define inline_cop(a)		S_inline_cop(aTHX_ a)
+#define inline_expr(a,b,c,d,e)	S_inline_expr(aTHX_ a,b,c,d,e)
+#define inline_arg(a,b,c,d)	S_inline_arg(aTHX_ a,b,c,d)
+#define tailcalls_enabled()	S_tailcalls_enabled(aTHX)
 #define looks_like_bool(a)	S_looks_like_bool(aTHX_ a)
 #define newGIVWHENOP(a,b,c,d,e)	S_newGIVWHENOP(aTHX_ a,b,c,d,e)
 #define ref_array_or_hash(a)	S_ref_array_or_hash(aTHX_ a)
@@ -3867,6 +3930,8 @@
 #if defined(PERL_IN_PP_HOT_C) || defined(PERL_DECL_PROT)
 #ifdef PERL_CORE
 #define do_oddball(a,b,c)	S_do_oddball(aTHX_ a,b,c)
+#define aassign_args()		S_aassign_args(aTHX)
+#define tail_call(a)		S_tail_call(aTHX_ a)
 #define method_common(a,b)	S_method_common(aTHX_ a,b)
 #endif
 #endif
@@ -4046,6 +4111,8 @@
 #define glob_assign_glob(a,b,c)	S_glob_assign_glob(aTHX_ a,b,c)
 #define glob_assign_ref(a,b)	S_glob_assign_ref(aTHX_ a,b)
 #define ptr_table_find		S_ptr_table_find
+#define sv_freeze_copy(a,b)	S_sv_freeze_copy(aTHX_ a,b)
+#define sv_freeze_free_seen(a)	S_sv_freeze_free_seen(aTHX_ a)
 #endif
 #endif
 #if defined(PERL_IN_TOKE_C) || defined(PERL_DECL_PROT)
@@ -4153,6 +4220,7 @@
 #define sv_utf8_upgrade_flags_grow(a,b,c)	Perl_sv_utf8_upgrade_flags_grow(aTHX_ a,b,c)
 #define sv_pvn_force_flags(a,b,c)	Perl_sv_pvn_force_flags(aTHX_ a,b,c)
 #define sv_copypv(a,b)		Perl_sv_copypv(aTHX_ a,b)
+#define sv_freeze(a)		Perl_sv_freeze(aTHX_ a)
 #define my_atof2(a,b)		Perl_my_atof2(aTHX_ a,b)
 #define my_socketpair		Perl_my_socketpair
 #define my_dirfd(a)		Perl_my_dirfd(aTHX_ a)
@@ -4174,6 +4242,8 @@
 #define PerlIO_setlinebuf(a)	Perl_PerlIO_setlinebuf(aTHX_ a)
 #define PerlIO_read(a,b,c)	Perl_PerlIO_read(aTHX_ a,b,c)
 #define PerlIO_write(a,b,c)	Perl_PerlIO_write(aTHX_ a,b,c)
+#define PerlIO_writev(a,b,c)	Perl_PerlIO_writev(aTHX_ a,b,c)
+#define PerlIO_copy(a,b,c)	Perl_PerlIO_copy(aTHX_ a,b,c)
 #define PerlIO_unread(a,b,c)	Perl_PerlIO_unread(aTHX_ a,b,c)
 #define PerlIO_tell(a)		Perl_PerlIO_tell(aTHX_ a)
 #define PerlIO_seek(a,b,c)	Perl_PerlIO_seek(aTHX_ a,b,c)
@@ -4500,6 +4570,13 @@
 #define mro_isa_changed_in(a)	Perl_mro_isa_changed_in(aTHX_ a)
 #endif
 #define mro_method_changed_in(a)	Perl_mro_method_changed_in(aTHX_ a)
+#define gv_method_changed(a)	Perl_gv_method_changed(aTHX_ a)
+#if defined(PERL_IN_MRO_C) || defined(PERL_DECL_PROT)
+#ifdef PERL_CORE
+#define mro_method_changed(a,b)	S_mro_method_changed(aTHX_ a,b)
+#define mro_overloaded(a)	S_mro_overloaded(aTHX_ a)
+#endif
+#endif
 #ifdef PERL_CORE
 #define boot_core_mro()		Perl_boot_core_mro(aTHX)
 #endif
@@ -4723,6 +4800,7 @@
 #define pp_i_negate()		Perl_pp_i_negate(aTHX)
 #define pp_i_subtract()		Perl_pp_i_subtract(aTHX)
 #define pp_index()		Perl_pp_index(aTHX)
+#define pp_inlinesub()		Perl_pp_inlinesub(aTHX)
 #define pp_int()		Perl_pp_int(aTHX)
 #define pp_ioctl()		Perl_pp_ioctl(aTHX)
 #define pp_iter()		Perl_pp_iter(aTHX)
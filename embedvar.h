@@ -144,6 +144,7 @@
 #define PL_forkprocess		(vTHX->Iforkprocess)
 #define PL_formfeed		(vTHX->Iformfeed)
 #define PL_formtarget		(vTHX->Iformtarget)
+#define PL_frozen_iters		(vTHX->Ifrozen_iters)
 #define PL_generation		(vTHX->Igeneration)
 #define PL_gensym		(vTHX->Igensym)
 #define PL_gid			(vTHX->Igid)
@@ -473,6 +474,7 @@
 #define PL_Iforkprocess		PL_forkprocess
 #define PL_Iformfeed		PL_formfeed
 #define PL_Iformtarget		PL_formtarget
+#define PL_Ifrozen_iters	PL_frozen_iters
 #define PL_Igeneration		PL_generation
 #define PL_Igensym		PL_gensym
 #define PL_Igid			PL_gid
@@ -0,0 +1,210 @@
+package Array::Dense;
+
+use strict;
+use warnings;
+
+require Tie::Array;
+require XSLoader;
+
+our @ISA = qw(Tie::Array);
+our $VERSION = '0.02';
+
+XSLoader::load('Array::Dense', $VERSION);
+
+# The tied array interface; FETCH, STORE, FETCHSIZE, STORESIZE, PUSH and
+# POP are aliases of the methods in Dense.xs, and Tie::Array supplies
+# SHIFT, UNSHIFT and SPLICE.
+
+sub TIEARRAY {
+    my ($class, $type, @values) = @_;
+    return $class->from_list($type, @values);
+}
+
+sub CLEAR   { $_[0]->resize(0) }
+sub EXTEND  { }
+sub EXISTS  { $_[1] < $_[0]->FETCHSIZE }
+sub DELETE  { my $old = $_[0]->FETCH($_[1]); $_[0]->STORE($_[1], 0); $old }
+
+1;
+__END__
+
+=head1 NAME
+
+Array::Dense - compact arrays of native integers and floating point numbers
+
+=head1 SYNOPSIS
+
+    use Array::Dense;
+
+    my $samples = Array::Dense->new('F', 1_000_000);	# a million zeros
+    $samples->set($_, rand) for 0 .. 999;
+    my $total = $samples->sum;
+    $samples->sort;
+
+    my $ids = Array::Dense->from_list('j', 3, 1, 2);
+    $ids->push(4, 5);
+    print $ids->get(-1), "\n";			# 5
+
+    my $bytes = Array::Dense->from_packed('C', $raw);
+    my $copy  = $bytes->packed;			# eq $raw
+
+    tie my @a, 'Array::Dense', 'F', 1.5, 2.5;
+    push @a, 3.5;
+    print tied(@a)->sum, "\n";			# 7.5
+
+=head1 DESCRIPTION
+
+An ordinary Perl array holds a full scalar for every element, which
+costs several times the size of the number it stores.  An Array::Dense
+array holds its elements back to back in one buffer, in their native
+format, so that an array of ten million doubles takes 80MB.
+
+A scalar is made only when an element is read.  Operations over the
+whole array, such as L</sum>, L</add> and L</sort>, work directly on the
+buffer without making any, and the arithmetic ones are written so that
+the compiler can use the processor's vector instructions for them.  The
+buffer is laid out exactly as L<perlfunc/pack> would lay out the same
+values, so L</packed> and L</from_packed> convert to and from binary
+data with a single copy.
+
+The element type is fixed when the array is created, and is given as a
+pack letter:
+
+=over 4
+
+=item C<j>
+
+Signed integers, the size of a Perl IV.
+
+=item C<J>
+
+Unsigned integers, the size of a Perl UV.
+
+=item C<F>
+
+Floating point numbers, the size of a Perl NV.
+
+=item C<C>
+
+Unsigned bytes, 0 to 255.
+
+=back
+
+Values stored in an array are converted with the usual numeric
+conversions, and for the integer types truncated to the width of the
+type.
+
+=head1 METHODS
+
+=over 4
+
+=item new TYPE, LENGTH
+
+Returns a new array of LENGTH zeros, or an empty one.
+
+=item from_list TYPE, LIST
+
+Returns a new array holding the values of LIST.
+
+=item from_packed TYPE, STRING
+
+Returns a new array whose buffer is a copy of STRING, which must hold a
+whole number of elements.  C<< Array::Dense->from_packed('F', pack('F*',
+@list)) >> holds the same values as C<< Array::Dense->from_list('F',
+@list) >>.
+
+=item type
+
+Returns the pack letter of the element type.
+
+=item length
+
+Returns the number of elements.
+
+=item resize LENGTH
+
+Truncates the array, or extends it with zeros, to LENGTH elements.
+
+=item get INDEX
+
+Returns the element at INDEX, counting from the end if INDEX is
+negative, or C<undef> if there is no such element.
+
+=item set INDEX, VALUE
+
+Stores VALUE at INDEX, extending the array with zeros if INDEX is past
+its end.
+
+=item push LIST
+
+Appends the values of LIST and returns the new length.  Space is added
+in proportion to the size of the array, so a long run of pushes takes
+linear time.
+
+=item pop
+
+Removes and returns the last element.
+
+=item list
+
+Returns all the elements as a list of scalars.
+
+=item packed
+
+Returns a copy of the buffer, as C<pack> would return it for the same
+values.
+
+=item sum
+
+Returns the sum of the elements.  Integers are summed exactly while the
+total fits in an integer.  Floating point numbers are summed in four
+interleaved running totals, which is faster than adding them in order
+but may differ from it in the last bits.
+
+=item min
+
+=item max
+
+Return the smallest or the largest element, or C<undef> if the array
+is empty.  For the C<F> type, NaNs are passed over unless every
+element is a NaN.
+
+=item add OTHER
+
+=item mul OTHER
+
+Add OTHER to each element, or multiply each element by it, in place.
+OTHER is either a number or another array of the same type and length,
+whose elements are taken in turn.  For the integer types the results
+wrap around at the width of the type, as in C.
+
+=item dot OTHER
+
+Returns the sum of the products of the elements of the array and the
+elements of OTHER, another array of the same type and length.  The
+products and the sum are worked in floating point, as for C<F> L</sum>.
+
+=item prefix_sum
+
+Replaces each element with the sum of itself and all the elements
+before it.  For the integer types the totals wrap around.
+
+=item sort
+
+Sorts the elements in place into ascending numeric order.  For the
+C<F> type, NaNs are moved to the end.
+
+=back
+
+=head1 TIED ARRAYS
+
+An array tied to Array::Dense stores its elements in an Array::Dense
+object, so that ordinary array syntax can be used on it.  The arguments
+to C<tie> after the class are those of L</from_list>.  C<tied> returns
+the object, for the operations over the whole array.
+
+=head1 SEE ALSO
+
+L<perlfunc/pack>, L<Tie::Array>
+
+=cut
@@ -0,0 +1,710 @@
+#define PERL_NO_GET_CONTEXT
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+/* An Array::Dense object is a reference to a blessed scalar whose string
+ * buffer holds the elements back to back in native format, as pack()
+ * would lay them out, with SvCUR the length in bytes.  The IV slot holds
+ * the pack letter of the element type; IOK stays off.  Being a plain
+ * scalar, it needs no DESTROY and is copied like any other value when a
+ * thread is created. */
+
+#define DENSE_IV	'j'
+#define DENSE_UV	'J'
+#define DENSE_NV	'F'
+#define DENSE_U8	'C'
+
+#define DenseTYPE(sv)	SvIVX(sv)
+#define DenseSIZE(sv)	S_elem_size(DenseTYPE(sv))
+#define DenseLEN(sv)	(SvCUR(sv) / DenseSIZE(sv))
+
+static STRLEN
+S_elem_size(IV type)
+{
+    switch (type) {
+    case DENSE_IV: return sizeof(IV);
+    case DENSE_UV: return sizeof(UV);
+    case DENSE_NV: return sizeof(NV);
+    default:	   return sizeof(U8);
+    }
+}
+
+static IV
+S_type_of(pTHX_ SV *type)
+{
+    STRLEN len;
+    const char * const pv = SvPV_const(type, len);
+
+    if (len != 1 || !strchr("jJFC", *pv))
+	croak("Array::Dense: unknown element type '%s'", pv);
+    return *pv;
+}
+
+static SV *
+S_dense_of(pTHX_ SV *self)
+{
+    SV *sv;
+
+    if (!SvROK(self) || !SvOBJECT(sv = SvRV(self)) || !SvPOK(sv)
+	|| SvTYPE(sv) != SVt_PVMG || !strchr("jJFC", (int)DenseTYPE(sv)))
+	croak("Not an Array::Dense object");
+    return sv;
+}
+
+static SV *
+S_dense_new(pTHX_ const char *class, IV type)
+{
+    SV * const sv = newSV_type(SVt_PVMG);
+    SV * const rv = newRV_noinc(sv);
+
+    sv_setpvs(sv, "");
+    SvIV_set(sv, type);
+    sv_bless(rv, gv_stashpv(class, GV_ADD));
+    return rv;
+}
+
+/* Set the number of elements, zero-filling any new ones.  Growing by at
+ * least half again keeps a run of pushes linear. */
+static void
+S_dense_resize(pTHX_ SV *sv, STRLEN n, bool exact)
+{
+    const STRLEN size = DenseSIZE(sv);
+    const STRLEN cur = SvCUR(sv);
+    STRLEN bytes;
+
+    if (n > (MEM_SIZE_MAX - 1) / size)
+	croak("Array::Dense: out of memory for %"UVuf" elements", (UV)n);
+    bytes = n * size;
+    if (bytes + 1 > SvLEN(sv)) {
+	STRLEN want = bytes + 1;
+	if (!exact && SvLEN(sv) < (MEM_SIZE_MAX / 3) && want < SvLEN(sv) / 2 * 3)
+	    want = SvLEN(sv) / 2 * 3;
+	SvGROW(sv, want);
+    }
+    if (bytes > cur)
+	Zero(SvPVX(sv) + cur, bytes - cur, char);
+    SvCUR_set(sv, bytes);
+    *SvEND(sv) = '\0';
+}
+
+static SV *
+S_elem_sv(pTHX_ SV *sv, STRLEN i)
+{
+    const char * const p = SvPVX_const(sv);
+
+    switch (DenseTYPE(sv)) {
+    case DENSE_IV: return newSViv(((const IV *)p)[i]);
+    case DENSE_UV: return newSVuv(((const UV *)p)[i]);
+    case DENSE_NV: return newSVnv(((const NV *)p)[i]);
+    default:	   return newSVuv(((const U8 *)p)[i]);
+    }
+}
+
+typedef union { IV iv; UV uv; NV nv; } dense_value;
+
+/* Convert val for storing in an array of the given type.  This may run
+ * code (tie, overloading) that changes the array, so it must be done
+ * before any pointer into the buffer is taken. */
+static dense_value
+S_value_of(pTHX_ IV type, SV *val)
+{
+    dense_value v;
+
+    switch (type) {
+    case DENSE_IV: v.iv = SvIV(val); break;
+    case DENSE_NV: v.nv = SvNV(val); break;
+    default:	   v.uv = SvUV(val); break;
+    }
+    return v;
+}
+
+/* Store val at offset i, extending the array if i is past the end. */
+static void
+S_elem_set(pTHX_ SV *sv, STRLEN i, SV *val)
+{
+    const dense_value v = S_value_of(aTHX_ DenseTYPE(sv), val);
+
+    if (i >= DenseLEN(sv))
+	S_dense_resize(aTHX_ sv, i + 1, FALSE);
+    switch (DenseTYPE(sv)) {
+    case DENSE_IV: ((IV *)SvPVX(sv))[i] = v.iv; break;
+    case DENSE_UV: ((UV *)SvPVX(sv))[i] = v.uv; break;
+    case DENSE_NV: ((NV *)SvPVX(sv))[i] = v.nv; break;
+    default:	   ((U8 *)SvPVX(sv))[i] = (U8)v.uv; break;
+    }
+}
+
+/* Map a Perl subscript, possibly negative, to an element offset; -1 if
+ * it is before the start. */
+static IV
+S_index(pTHX_ SV *sv, IV ix)
+{
+    if (ix < 0)
+	ix += (IV)DenseLEN(sv);
+    return ix < 0 ? -1 : ix;
+}
+
+/* The right operand of an elementwise operation: another array of the
+ * same type and length, whose buffer is returned, or a number, which is
+ * converted into *v and NULL returned. */
+static const char *
+S_operand(pTHX_ SV *sv, SV *other, dense_value *v)
+{
+    SV *osv;
+
+    if (!SvROK(other) || !SvOBJECT(SvRV(other))) {
+	*v = S_value_of(aTHX_ DenseTYPE(sv), other);
+	return NULL;
+    }
+    osv = S_dense_of(aTHX_ other);
+    if (DenseTYPE(osv) != DenseTYPE(sv))
+	croak("Array::Dense: element types '%c' and '%c' differ",
+	      (int)DenseTYPE(sv), (int)DenseTYPE(osv));
+    if (DenseLEN(osv) != DenseLEN(sv))
+	croak("Array::Dense: lengths %"UVuf" and %"UVuf" differ",
+	      (UV)DenseLEN(sv), (UV)DenseLEN(osv));
+    return SvPVX_const(osv);
+}
+
+/* The kernels below work through the buffer in blocks of four elements,
+ * loading all of a block before storing any of it, and keep four
+ * separate running totals in reductions.  That lets the compiler put a
+ * block in SIMD registers without checking whether the operands overlap,
+ * and lets a floating point total proceed without waiting for the
+ * previous addition, at the default optimization level.  A total of
+ * doubles may therefore differ in its last bits from adding in order.
+ *
+ * The signed type is worked on as UVs, so that integer results wrap
+ * around as they do for the unsigned types; C leaves signed overflow
+ * undefined. */
+
+#define DENSE_APPLY(T, d, e, s, len, OP)	STMT_START {		\
+	T * const d_ = (T *)(d);					\
+	const T * const e_ = (const T *)(e);				\
+	STRLEN i_ = 0;							\
+	if (e_) {							\
+	    for (; i_ + 4 <= (len); i_ += 4) {				\
+		const T a0 = d_[i_], a1 = d_[i_+1], a2 = d_[i_+2], a3 = d_[i_+3]; \
+		const T b0 = e_[i_], b1 = e_[i_+1], b2 = e_[i_+2], b3 = e_[i_+3]; \
+		d_[i_]   = (T)(a0 OP b0); d_[i_+1] = (T)(a1 OP b1);	\
+		d_[i_+2] = (T)(a2 OP b2); d_[i_+3] = (T)(a3 OP b3);	\
+	    }								\
+	    for (; i_ < (len); i_++)					\
+		d_[i_] = (T)(d_[i_] OP e_[i_]);				\
+	}								\
+	else {								\
+	    const T b_ = (T)(s);					\
+	    for (; i_ < (len); i_++)					\
+		d_[i_] = (T)(d_[i_] OP b_);				\
+	}								\
+    } STMT_END
+
+#define DENSE_DOT(T, p, q, len, total)	STMT_START {			\
+	const T * const p_ = (const T *)(p);				\
+	const T * const q_ = (const T *)(q);				\
+	NV t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;			\
+	STRLEN i_ = 0;							\
+	for (; i_ + 4 <= (len); i_ += 4) {				\
+	    t0 += (NV)p_[i_]   * (NV)q_[i_];				\
+	    t1 += (NV)p_[i_+1] * (NV)q_[i_+1];				\
+	    t2 += (NV)p_[i_+2] * (NV)q_[i_+2];				\
+	    t3 += (NV)p_[i_+3] * (NV)q_[i_+3];				\
+	}								\
+	for (; i_ < (len); i_++)					\
+	    t0 += (NV)p_[i_] * (NV)q_[i_];				\
+	(total) = (t0 + t1) + (t2 + t3);				\
+    } STMT_END
+
+/* Minimum (CMP <) or maximum (CMP >) of p[start..len-1], which must not
+ * be empty */
+#define DENSE_EXTREME(T, p, start, len, CMP, best)	STMT_START {	\
+	const T * const p_ = (const T *)(p);				\
+	T m_ = p_[start];						\
+	STRLEN i_;							\
+	for (i_ = (start) + 1; i_ < (len); i_++)			\
+	    m_ = p_[i_] CMP m_ ? p_[i_] : m_;				\
+	(best) = m_;							\
+    } STMT_END
+
+#define DENSE_SCAN(T, p, len)	STMT_START {				\
+	T * const p_ = (T *)(p);					\
+	T t_ = 0;							\
+	STRLEN i_;							\
+	for (i_ = 0; i_ < (len); i_++)					\
+	    p_[i_] = t_ = (T)(t_ + p_[i_]);				\
+    } STMT_END
+
+static int
+S_cmp_iv(const void *a, const void *b)
+{
+    const IV x = *(const IV *)a, y = *(const IV *)b;
+    return x < y ? -1 : x > y;
+}
+
+static int
+S_cmp_uv(const void *a, const void *b)
+{
+    const UV x = *(const UV *)a, y = *(const UV *)b;
+    return x < y ? -1 : x > y;
+}
+
+static int
+S_cmp_nv(const void *a, const void *b)
+{
+    const NV x = *(const NV *)a, y = *(const NV *)b;
+    return x < y ? -1 : x > y;
+}
+
+MODULE = Array::Dense		PACKAGE = Array::Dense
+
+PROTOTYPES: DISABLE
+
+SV *
+new(class, type, length = 0)
+	const char *class
+	SV *type
+	UV length
+    CODE:
+	RETVAL = S_dense_new(aTHX_ class, S_type_of(aTHX_ type));
+	S_dense_resize(aTHX_ SvRV(RETVAL), length, TRUE);
+    OUTPUT:
+	RETVAL
+
+SV *
+from_list(class, type, ...)
+	const char *class
+	SV *type
+    PREINIT:
+	SV *sv;
+	I32 i;
+    CODE:
+	RETVAL = S_dense_new(aTHX_ class, S_type_of(aTHX_ type));
+	sv = SvRV(RETVAL);
+	S_dense_resize(aTHX_ sv, items - 2, TRUE);
+	for (i = 2; i < items; i++)
+	    S_elem_set(aTHX_ sv, i - 2, ST(i));
+    OUTPUT:
+	RETVAL
+
+SV *
+from_packed(class, type, packed)
+	const char *class
+	SV *type
+	SV *packed
+    PREINIT:
+	SV *sv;
+	STRLEN len;
+	const char *pv;
+    CODE:
+	RETVAL = S_dense_new(aTHX_ class, S_type_of(aTHX_ type));
+	sv = SvRV(RETVAL);
+	pv = SvPVbyte(packed, len);
+	if (len % DenseSIZE(sv)) {
+	    SvREFCNT_dec(RETVAL);
+	    croak("Array::Dense: packed length %"UVuf" is not a multiple of the element size", (UV)len);
+	}
+	sv_setpvn(sv, pv, len);
+    OUTPUT:
+	RETVAL
+
+SV *
+type(self)
+	SV *self
+    CODE:
+	{
+	    const char type = (char)DenseTYPE(S_dense_of(aTHX_ self));
+	    RETVAL = newSVpvn(&type, 1);
+	}
+    OUTPUT:
+	RETVAL
+
+UV
+length(self)
+	SV *self
+    ALIAS:
+	FETCHSIZE = 1
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	RETVAL = DenseLEN(S_dense_of(aTHX_ self));
+    OUTPUT:
+	RETVAL
+
+void
+resize(self, length)
+	SV *self
+	UV length
+    ALIAS:
+	STORESIZE = 1
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	S_dense_resize(aTHX_ S_dense_of(aTHX_ self), length, TRUE);
+
+SV *
+get(self, index)
+	SV *self
+	IV index
+    ALIAS:
+	FETCH = 1
+    PREINIT:
+	SV *sv;
+	IV i;
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	sv = S_dense_of(aTHX_ self);
+	i = S_index(aTHX_ sv, index);
+	if (i < 0 || (UV)i >= DenseLEN(sv))
+	    XSRETURN_UNDEF;
+	RETVAL = S_elem_sv(aTHX_ sv, i);
+    OUTPUT:
+	RETVAL
+
+void
+set(self, index, value)
+	SV *self
+	IV index
+	SV *value
+    ALIAS:
+	STORE = 1
+    PREINIT:
+	SV *sv;
+	IV i;
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	sv = S_dense_of(aTHX_ self);
+	i = S_index(aTHX_ sv, index);
+	if (i < 0)
+	    croak("Modification of non-creatable array value attempted, subscript %"IVdf, index);
+	S_elem_set(aTHX_ sv, i, value);
+
+UV
+push(self, ...)
+	SV *self
+    ALIAS:
+	PUSH = 1
+    PREINIT:
+	SV *sv;
+	STRLEN len;
+	I32 i;
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	sv = S_dense_of(aTHX_ self);
+	len = DenseLEN(sv);
+	S_dense_resize(aTHX_ sv, len + items - 1, FALSE);
+	for (i = 1; i < items; i++)
+	    S_elem_set(aTHX_ sv, len + i - 1, ST(i));
+	RETVAL = DenseLEN(sv);
+    OUTPUT:
+	RETVAL
+
+SV *
+pop(self)
+	SV *self
+    ALIAS:
+	POP = 1
+    PREINIT:
+	SV *sv;
+	STRLEN len;
+    CODE:
+	PERL_UNUSED_VAR(ix);
+	sv = S_dense_of(aTHX_ self);
+	if (!(len = DenseLEN(sv)))
+	    XSRETURN_UNDEF;
+	RETVAL = S_elem_sv(aTHX_ sv, len - 1);
+	S_dense_resize(aTHX_ sv, len - 1, TRUE);
+    OUTPUT:
+	RETVAL
+
+void
+list(self)
+	SV *self
+    PREINIT:
+	SV *sv;
+	STRLEN len, i;
+    PPCODE:
+	sv = S_dense_of(aTHX_ self);
+	len = DenseLEN(sv);
+	EXTEND(SP, (IV)len);
+	for (i = 0; i < len; i++)
+	    mPUSHs(S_elem_sv(aTHX_ sv, i));
+
+SV *
+packed(self)
+	SV *self
+    PREINIT:
+	SV *sv;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	RETVAL = newSVpvn(SvPVX_const(sv), SvCUR(sv));
+    OUTPUT:
+	RETVAL
+
+SV *
+sum(self)
+	SV *self
+    PREINIT:
+	SV *sv;
+	STRLEN len, i;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	len = DenseLEN(sv);
+	switch (DenseTYPE(sv)) {
+	case DENSE_NV: {
+	    const NV * const p = (const NV *)SvPVX_const(sv);
+	    NV t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;
+	    for (i = 0; i + 4 <= len; i += 4) {
+		t0 += p[i];
+		t1 += p[i+1];
+		t2 += p[i+2];
+		t3 += p[i+3];
+	    }
+	    for (; i < len; i++)
+		t0 += p[i];
+	    RETVAL = newSVnv((t0 + t1) + (t2 + t3));
+	    break;
+	}
+	case DENSE_IV: {
+	    /* Sum in an IV while that is exact, then carry on in an NV */
+	    const IV * const p = (const IV *)SvPVX_const(sv);
+	    IV total = 0;
+	    for (i = 0; i < len; i++) {
+		const IV v = p[i];
+		if (v > 0 ? total > IV_MAX - v : total < IV_MIN - v)
+		    break;
+		total += v;
+	    }
+	    if (i == len)
+		RETVAL = newSViv(total);
+	    else {
+		NV ntotal = (NV)total;
+		for (; i < len; i++)
+		    ntotal += (NV)p[i];
+		RETVAL = newSVnv(ntotal);
+	    }
+	    break;
+	}
+	case DENSE_UV: {
+	    const UV * const p = (const UV *)SvPVX_const(sv);
+	    UV total = 0;
+	    for (i = 0; i < len; i++) {
+		if (total > UV_MAX - p[i])
+		    break;
+		total += p[i];
+	    }
+	    if (i == len)
+		RETVAL = newSVuv(total);
+	    else {
+		NV ntotal = (NV)total;
+		for (; i < len; i++)
+		    ntotal += (NV)p[i];
+		RETVAL = newSVnv(ntotal);
+	    }
+	    break;
+	}
+	default: {
+	    const U8 * const p = (const U8 *)SvPVX_const(sv);
+	    UV total = 0;
+	    for (i = 0; i < len; i++)
+		total += p[i];
+	    RETVAL = newSVuv(total);
+	    break;
+	}
+	}
+    OUTPUT:
+	RETVAL
+
+void
+sort(self)
+	SV *self
+    PREINIT:
+	SV *sv;
+	STRLEN len, i;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	len = DenseLEN(sv);
+	switch (DenseTYPE(sv)) {
+	case DENSE_IV:
+	    qsort(SvPVX(sv), len, sizeof(IV), S_cmp_iv);
+	    break;
+	case DENSE_UV:
+	    qsort(SvPVX(sv), len, sizeof(UV), S_cmp_uv);
+	    break;
+	case DENSE_NV: {
+	    /* NaNs are unordered: move them to the end, sort the rest */
+	    NV * const p = (NV *)SvPVX(sv);
+	    STRLEN n = 0;
+	    for (i = 0; i < len; i++) {
+		if (!Perl_isnan(p[i])) {
+		    const NV v = p[i];
+		    p[i] = p[n];
+		    p[n++] = v;
+		}
+	    }
+	    qsort(p, n, sizeof(NV), S_cmp_nv);
+	    break;
+	}
+	default: {
+	    /* Counting sort */
+	    U8 * const p = (U8 *)SvPVX(sv);
+	    STRLEN count[256];
+	    unsigned int v;
+	    Zero(count, 256, STRLEN);
+	    for (i = 0; i < len; i++)
+		count[p[i]]++;
+	    for (v = 0, i = 0; v < 256; v++) {
+		STRLEN n = count[v];
+		while (n--)
+		    p[i++] = (U8)v;
+	    }
+	    break;
+	}
+	}
+
+void
+add(self, other)
+	SV *self
+	SV *other
+    ALIAS:
+	mul = 1
+    PREINIT:
+	SV *sv;
+	const char *q;
+	dense_value v;
+	STRLEN len;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	q = S_operand(aTHX_ sv, other, &v);
+	len = DenseLEN(sv);
+	switch (DenseTYPE(sv)) {
+	case DENSE_NV:
+	    if (ix)
+		DENSE_APPLY(NV, SvPVX(sv), q, v.nv, len, *);
+	    else
+		DENSE_APPLY(NV, SvPVX(sv), q, v.nv, len, +);
+	    break;
+	case DENSE_U8:
+	    if (ix)
+		DENSE_APPLY(U8, SvPVX(sv), q, v.uv, len, *);
+	    else
+		DENSE_APPLY(U8, SvPVX(sv), q, v.uv, len, +);
+	    break;
+	default:
+	    /* v.iv and v.uv share their bits */
+	    if (ix)
+		DENSE_APPLY(UV, SvPVX(sv), q, v.uv, len, *);
+	    else
+		DENSE_APPLY(UV, SvPVX(sv), q, v.uv, len, +);
+	    break;
+	}
+
+NV
+dot(self, other)
+	SV *self
+	SV *other
+    PREINIT:
+	SV *sv;
+	const char *q;
+	dense_value v;
+	STRLEN len;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	if (!SvROK(other) || !SvOBJECT(SvRV(other)))
+	    croak("Not an Array::Dense object");
+	q = S_operand(aTHX_ sv, other, &v);
+	len = DenseLEN(sv);
+	switch (DenseTYPE(sv)) {
+	case DENSE_IV:
+	    DENSE_DOT(IV, SvPVX_const(sv), q, len, RETVAL);
+	    break;
+	case DENSE_UV:
+	    DENSE_DOT(UV, SvPVX_const(sv), q, len, RETVAL);
+	    break;
+	case DENSE_NV:
+	    DENSE_DOT(NV, SvPVX_const(sv), q, len, RETVAL);
+	    break;
+	default:
+	    DENSE_DOT(U8, SvPVX_const(sv), q, len, RETVAL);
+	    break;
+	}
+    OUTPUT:
+	RETVAL
+
+SV *
+min(self)
+	SV *self
+    ALIAS:
+	max = 1
+    PREINIT:
+	SV *sv;
+	STRLEN len;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	if (!(len = DenseLEN(sv)))
+	    XSRETURN_UNDEF;
+	switch (DenseTYPE(sv)) {
+	case DENSE_IV: {
+	    IV m;
+	    if (ix)
+		DENSE_EXTREME(IV, SvPVX_const(sv), 0, len, >, m);
+	    else
+		DENSE_EXTREME(IV, SvPVX_const(sv), 0, len, <, m);
+	    RETVAL = newSViv(m);
+	    break;
+	}
+	case DENSE_UV: {
+	    UV m;
+	    if (ix)
+		DENSE_EXTREME(UV, SvPVX_const(sv), 0, len, >, m);
+	    else
+		DENSE_EXTREME(UV, SvPVX_const(sv), 0, len, <, m);
+	    RETVAL = newSVuv(m);
+	    break;
+	}
+	case DENSE_NV: {
+	    /* Start from the first number; comparisons with any later NaN
+	     * are false, so they are passed over too. */
+	    const NV * const p = (const NV *)SvPVX_const(sv);
+	    STRLEN start = 0;
+	    NV m;
+	    while (start < len - 1 && Perl_isnan(p[start]))
+		start++;
+	    if (ix)
+		DENSE_EXTREME(NV, p, start, len, >, m);
+	    else
+		DENSE_EXTREME(NV, p, start, len, <, m);
+	    RETVAL = newSVnv(m);
+	    break;
+	}
+	default: {
+	    U8 m;
+	    if (ix)
+		DENSE_EXTREME(U8, SvPVX_const(sv), 0, len, >, m);
+	    else
+		DENSE_EXTREME(U8, SvPVX_const(sv), 0, len, <, m);
+	    RETVAL = newSVuv(m);
+	    break;
+	}
+	}
+    OUTPUT:
+	RETVAL
+
+void
+prefix_sum(self)
+	SV *self
+    PREINIT:
+	SV *sv;
+	STRLEN len;
+    CODE:
+	sv = S_dense_of(aTHX_ self);
+	len = DenseLEN(sv);
+	switch (DenseTYPE(sv)) {
+	case DENSE_NV:
+	    DENSE_SCAN(NV, SvPVX(sv), len);
+	    break;
+	case DENSE_U8:
+	    DENSE_SCAN(U8, SvPVX(sv), len);
+	    break;
+	default:
+	    DENSE_SCAN(UV, SvPVX(sv), len);
+	    break;
+	}
@@ -0,0 +1,145 @@
+#!./perl
+
+BEGIN {
+    require Config; import Config;
+    if ($Config{'extensions'} !~ /\bArray\/Dense\b/) {
+	print "1..0 # Skip: Array::Dense was not built\n";
+	exit 0;
+    }
+}
+
+use strict;
+use warnings;
+use Test::More tests => 75;
+
+BEGIN { use_ok('Array::Dense') }
+
+my $a = Array::Dense->new('F', 5);
+isa_ok($a, 'Array::Dense');
+is($a->type, 'F', 'type');
+is($a->length, 5, 'new() length');
+is_deeply([$a->list], [0, 0, 0, 0, 0], 'new() zero-fills');
+is($a->packed, pack('F*', (0) x 5), 'packed layout');
+
+$a->set(1, 2.5);
+$a->set(-1, 7);
+is($a->get(1), 2.5, 'set and get');
+is($a->get(4), 7, 'negative index counts from the end');
+is($a->get(-4), 2.5, 'negative get');
+is($a->get(5), undef, 'get past the end');
+is($a->get(-6), undef, 'get before the start');
+ok(!eval { $a->set(-6, 1); 1 }, 'set before the start croaks');
+like($@, qr/non-creatable array value/, '... with the array message');
+$a->set(7, 1);
+is($a->length, 8, 'set past the end extends');
+is($a->get(6), 0, '... with zeros');
+
+is($a->push(3, 4), 10, 'push returns the new length');
+is($a->pop, 4, 'pop');
+is($a->length, 9, 'pop shrinks');
+is($a->sum, 13.5, 'sum of doubles');
+$a->resize(2);
+is_deeply([$a->list], [0, 2.5], 'resize truncates');
+
+my $i = Array::Dense->from_list('j', 3, -1, 2, 10, -7);
+is_deeply([$i->list], [3, -1, 2, 10, -7], 'from_list');
+is($i->sum, 7, 'sum of IVs');
+$i->sort;
+is_deeply([$i->list], [-7, -1, 2, 3, 10], 'sort IVs');
+$i->set(0, 2.9);
+is($i->get(0), 2, 'IVs truncate');
+
+my $max = ~0 >> 1;
+my $big = Array::Dense->from_list('j', $max, $max, 2);
+is($big->sum, 2 * $max + 2, 'IV sum overflows into an NV');
+my $neg = Array::Dense->from_list('j', -$max, -$max, -3);
+is($neg->sum, -2 * $max - 3, '... for negative totals too');
+
+my $u = Array::Dense->from_list('J', ~0, 5, 1);
+is($u->get(0), ~0, 'UVs');
+is($u->sum, ~0 + 6, 'UV sum overflows into an NV');
+$u->sort;
+is_deeply([$u->list], [1, 5, ~0], 'sort UVs');
+
+my $c = Array::Dense->from_list('C', 300, 2, 255, 0, 2);
+is_deeply([$c->list], [44, 2, 255, 0, 2], 'bytes wrap');
+is($c->sum, 303, 'sum of bytes');
+$c->sort;
+is_deeply([$c->list], [0, 2, 2, 44, 255], 'sort bytes');
+is($c->packed, pack('C*', 0, 2, 2, 44, 255), 'bytes are packed');
+
+my $p = Array::Dense->from_packed('F', pack('F*', 3, 1, 2));
+is_deeply([$p->list], [3, 1, 2], 'from_packed');
+ok(!eval { Array::Dense->from_packed('F', 'abc'); 1 }, 'partial element');
+like($@, qr/not a multiple of the element size/, '... croaks');
+ok(!eval { Array::Dense->new('x'); 1 }, 'unknown type');
+like($@, qr/unknown element type 'x'/, '... croaks');
+ok(!eval { Array::Dense::get([], 0); 1 }, 'not an object');
+
+my $nan = 9**9**9 / 9**9**9;
+my $n = Array::Dense->from_list('F', 2, $nan, 1, $nan, 3);
+$n->sort;
+my @n = $n->list;
+is_deeply([@n[0..2]], [1, 2, 3], 'NaNs sorted past the numbers');
+ok($n[3] != $n[3] && $n[4] != $n[4], '... to the end');
+
+tie my @t, 'Array::Dense', 'F', 1.5, 2.5;
+is(scalar(@t), 2, 'tied FETCHSIZE');
+push @t, 3.5;
+is($t[-1], 3.5, 'tied PUSH and negative FETCH');
+$t[4] = 1;
+is("@t", '1.5 2.5 3.5 0 1', 'tied STORE extends');
+is(tied(@t)->sum, 8.5, 'tied() gives the object');
+is(shift(@t), 1.5, 'tied SHIFT');
+is(pop(@t), 1, 'tied POP');
+$#t = 0;
+is("@t", '2.5', 'tied STORESIZE');
+
+my $x = Array::Dense->from_list('F', 1 .. 10);
+my $y = Array::Dense->from_list('F', map $_ / 2, 1 .. 10);
+is($x->dot($y), 192.5, 'dot of doubles');
+$x->add($y);
+is_deeply([$x->list], [map $_ * 1.5, 1 .. 10], 'add an array');
+$x->mul(2);
+is_deeply([$x->list], [map $_ * 3, 1 .. 10], 'multiply by a number');
+$x->add($x);
+is_deeply([$x->list], [map $_ * 6, 1 .. 10], 'add to itself');
+$y->mul($y);
+is($y->sum, 96.25, 'multiply by itself');
+is($x->min, 6, 'min');
+is($x->max, 60, 'max');
+$x->prefix_sum;
+is_deeply([$x->list], [map 3 * $_ * ($_ + 1), 1 .. 10], 'prefix_sum');
+
+my $s = Array::Dense->from_list('j', -5, 3, 9, -2, 7, 0);
+is($s->min, -5, 'min of IVs');
+is($s->max, 9, 'max of IVs');
+is($s->dot($s), 168, 'dot of IVs');
+$s->mul(-3);
+is_deeply([$s->list], [15, -9, -27, 6, -21, 0], 'multiply IVs');
+$s->add(Array::Dense->from_list('j', 1 .. 6));
+is_deeply([$s->list], [16, -7, -24, 10, -16, 6], 'add IVs');
+$s->prefix_sum;
+is_deeply([$s->list], [16, 9, -15, -5, -21, -15], 'prefix_sum of IVs');
+my $w = Array::Dense->from_list('j', $max, 1);
+$w->add(1);
+is($w->get(0), -$max - 1, 'IVs wrap around');
+
+my $b = Array::Dense->from_list('C', 200, 100, 7);
+$b->add(100);
+is_deeply([$b->list], [44, 200, 107], 'bytes wrap around');
+is($b->max, 200, 'max of bytes');
+is($b->dot($b), 44**2 + 200**2 + 107**2, 'dot of bytes does not wrap');
+my $uu = Array::Dense->from_list('J', 4, ~0, 2);
+is($uu->min, 2, 'min of UVs');
+is($uu->max, ~0, 'max of UVs');
+
+my $m = Array::Dense->from_list('F', $nan, 4, $nan, -1, 3);
+is($m->min, -1, 'min skips NaNs');
+is($m->max, 4, 'max skips NaNs');
+is(Array::Dense->new('F')->min, undef, 'min of nothing');
+
+ok(!eval { $x->add(Array::Dense->new('F', 3)); 1 }, 'lengths must match');
+like($@, qr/lengths 10 and 3 differ/, '... croaks');
+ok(!eval { $x->dot(Array::Dense->from_list('j', 1 .. 10)); 1 }, 'types must match');
+like($@, qr/element types 'F' and 'j' differ/, '... croaks');
@@ -14,7 +14,7 @@ use warnings; # uses #3 and #4, since warnings uses Carp
 
 use Exporter (); # use #5
 
-our $VERSION   = "0.78";
+our $VERSION   = "0.80";
 our @ISA       = qw(Exporter);
 our @EXPORT_OK = qw( set_style set_style_standard add_callback
 		     concise_subref concise_cv concise_main
@@ -597,7 +597,9 @@ $priv{$_}{128} = "LVINTRO"
        "rv2av", "rv2arylen", "aelem", "helem", "aslice", "hslice", "padsv",
        "padav", "padhv", "enteriter");
 $priv{$_}{64} = "REFC" for ("leave", "leavesub", "leavesublv", "leavewrite");
+$priv{$_}{32} = "TAIL" for ("return", "leavesub");
 $priv{"aassign"}{64} = "COMMON";
+$priv{"aassign"}{4} = "ARGS";
 $priv{"aassign"}{32} = $] < 5.009 ? "PHASH" : "STATE";
 $priv{"sassign"}{32} = "STATE";
 $priv{"sassign"}{64} = "BKWARD";
@@ -634,7 +636,7 @@ $priv{"flip"}{64} = $priv{"flop"}{64} = "LINENUM";
 $priv{"list"}{64} = "GUESSED";
 $priv{"delete"}{64} = "SLICE";
 $priv{"exists"}{64} = "SUB";
-@{$priv{"sort"}}{1,2,4,8,16,32,64} = ("NUM", "INT", "REV", "INPLACE","DESC","QSORT","STABLE");
+@{$priv{"sort"}}{1,2,4,8,16,32,64,128} = ("NUM", "INT", "REV", "INPLACE","DESC","QSORT","STABLE","PARALLEL");
 $priv{"reverse"}{8} = "INPLACE";
 $priv{"threadsv"}{64} = "SVREFd";
 @{$priv{$_}}{16,32,64,128} = ("INBIN","INCR","OUTBIN","OUTCR")
@@ -643,6 +645,7 @@ $priv{"exit"}{128} = "VMS";
 $priv{$_}{2} = "FTACCESS"
   for ("ftrread", "ftrwrite", "ftrexec", "fteread", "ftewrite", "fteexec");
 $priv{"entereval"}{2} = "HAS_HH";
+$priv{"inlinesub"}{2} = "CALL";
 if ($] >= 5.009) {
   # Stacked filetests are post 5.8.x
   $priv{$_}{4} = "FTSTACKED"
@@ -699,6 +702,9 @@ sub concise_sv {
     $hr->{svclass} = class($sv);
     $hr->{svclass} = "UV"
       if $hr->{svclass} eq "IV" and $sv->FLAGS & SVf_IVisUV;
+    # method_named upgrades its name to carry a method cache once it
+    # has run; it is still just the name
+    $hr->{svclass} = "PV" if $preferpv and $hr->{svclass} eq "PVMG";
     Carp::cluck("bad concise_sv: $sv") unless $sv and $$sv;
     $hr->{svaddr} = sprintf("%#x", $$sv);
     if ($hr->{svclass} eq "GV" && $sv->isGV_with_GP()) {
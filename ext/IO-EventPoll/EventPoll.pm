@@ -0,0 +1,138 @@
+package IO::EventPoll;
+
+use strict;
+use warnings;
+
+require Exporter;
+require XSLoader;
+
+our @ISA = qw(Exporter);
+our $VERSION = '0.01';
+
+our @EXPORT_OK = qw(EPOLLIN EPOLLOUT EPOLLPRI EPOLLERR EPOLLHUP EPOLLRDHUP
+		    EPOLLET EPOLLONESHOT);
+our %EXPORT_TAGS = (constants => [@EXPORT_OK]);
+
+XSLoader::load('IO::EventPoll', $VERSION);
+
+# The epoll descriptor belongs to the thread that created it; a copy
+# made when a thread is spawned would close it a second time.
+sub CLONE_SKIP { 1 }
+
+1;
+__END__
+
+=head1 NAME
+
+IO::EventPoll - scalable I/O readiness notification with epoll(7)
+
+=head1 SYNOPSIS
+
+    use IO::EventPoll qw(:constants);
+
+    my $ep = IO::EventPoll->new or die "epoll: $!";
+
+    $ep->add($listener, EPOLLIN) or die "add: $!";
+    $ep->add($sock, EPOLLIN | EPOLLOUT);
+    $ep->modify($sock, EPOLLIN);
+    $ep->remove($sock);
+
+    while (1) {
+	my %ready = $ep->wait(2.5);	# fd => events
+	for my $fd (keys %ready) {
+	    handle_read($fd)  if $ready{$fd} & EPOLLIN;
+	    handle_write($fd) if $ready{$fd} & EPOLLOUT;
+	}
+    }
+
+=head1 DESCRIPTION
+
+C<select> (and L<IO::Select>, which is built on it) passes the whole set
+of interesting descriptors to the kernel on every call, and the cost of
+each call grows with the highest descriptor number.  That is fine for a
+handful of handles, but an event loop watching thousands of sockets
+spends most of its time building and scanning bit vectors.
+
+IO::EventPoll uses the Linux epoll interface instead.  The set of watched
+handles lives in the kernel and is changed only when you call C<add>,
+C<modify> or C<remove>; C<wait> costs time proportional to the number of
+handles that are actually ready.
+
+Handles may be passed as filehandles (globs, glob references or
+L<IO::Handle> objects) or as plain file descriptor numbers.  Events are
+always reported by file descriptor number.
+
+=head2 Methods
+
+=over 4
+
+=item new
+
+Creates a new, empty interest set.  Returns C<undef> and sets C<$!> on
+failure.  Dies on systems without epoll.
+
+=item add ( HANDLE, EVENTS )
+
+Starts watching HANDLE for EVENTS, a bitwise-or of the constants below.
+
+=item modify ( HANDLE, EVENTS )
+
+Changes the events HANDLE is watched for.
+
+=item remove ( HANDLE )
+
+Stops watching HANDLE.  A handle is removed automatically when the last
+descriptor referring to it is closed.
+
+C<add>, C<modify> and C<remove> return true on success, and false with
+C<$!> set on failure.
+
+=item wait ( [ TIMEOUT [, MAXEVENTS ] ] )
+
+Waits until at least one watched handle is ready, or TIMEOUT seconds
+(which may be fractional) have passed.  An undefined TIMEOUT waits
+forever, and a TIMEOUT of 0 polls without blocking.
+
+Returns a list of pairs, a file descriptor followed by the events that
+are ready on it, for at most MAXEVENTS (default 256) handles.  Any other
+ready handles are reported by the next call.  The list is suitable for
+assigning to a hash.  Like L<IO::Select>, an empty list is returned both
+on timeout and on failure; in the latter case C<$!> is set, for example
+to C<EINTR> when a signal arrived.
+
+=item fileno
+
+Returns the descriptor of the epoll instance itself.  It becomes readable
+when any watched handle is ready, so one set may be nested in another or
+in C<select>.
+
+=item close
+
+Closes the epoll instance.  This also happens when the object is
+destroyed.
+
+=back
+
+=head2 Constants
+
+The following may be imported individually or with the C<:constants>
+tag: C<EPOLLIN>, C<EPOLLOUT>, C<EPOLLPRI>, C<EPOLLERR>, C<EPOLLHUP>,
+C<EPOLLRDHUP>, C<EPOLLET> and C<EPOLLONESHOT>.  See L<epoll_ctl(2)> for
+their meanings.  C<EPOLLERR> and C<EPOLLHUP> are always reported and
+need not be requested.  The constants are defined on every system, so
+that code importing them compiles even where C<new> is not available.
+
+=head1 CAVEATS
+
+The data returned by C<wait> is the raw readiness state of the
+descriptor.  Data already read into a PerlIO buffer does not make a
+handle readable, so use C<sysread> (or unbuffered layers) on watched
+handles, exactly as with C<select>.
+
+An IO::EventPoll object is not copied into new threads.
+
+=head1 SEE ALSO
+
+L<IO::Select>, L<IO::Poll>, L<perlfunc/select>, L<epoll(7)>
+
+=cut
@@ -0,0 +1,237 @@
+#define PERL_NO_GET_CONTEXT
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+/* There is no Configure probe for epoll; it is Linux only. */
+#if defined(__linux__)
+#  include <sys/epoll.h>
+#  define PERL_HAS_EPOLL
+#else
+#  define EPOLL_CTL_ADD	1
+#  define EPOLL_CTL_DEL	2
+#  define EPOLL_CTL_MOD	3
+#endif
+
+/* The event constants exist everywhere, with the Linux values where
+ * there is no epoll, so that code naming them compiles on any system. */
+#ifndef EPOLLIN
+#  define EPOLLIN	0x001
+#  define EPOLLPRI	0x002
+#  define EPOLLOUT	0x004
+#  define EPOLLERR	0x008
+#  define EPOLLHUP	0x010
+#  define EPOLLONESHOT	(1U << 30)
+#  define EPOLLET	(1U << 31)
+#endif
+#ifndef EPOLLRDHUP
+#  define EPOLLRDHUP	0x2000
+#endif
+
+#ifdef I_FCNTL
+#  include <fcntl.h>
+#endif
+
+typedef int SysRet;
+
+/* Largest batch of events collected by one wait() */
+#define EPOLL_MAX_EVENTS	4096
+
+static int
+not_here(const char *s)
+{
+    croak("IO::EventPoll::%s not implemented on this architecture", s);
+    return -1;
+}
+
+/* Accept either a filehandle (glob, glob ref or IO::Handle object) or a
+ * plain file descriptor number. */
+static int
+S_fd_of(pTHX_ SV *sv)
+{
+    if (SvROK(sv) || isGV_with_GP(sv)) {
+	IO * const io = sv_2io(sv);
+	PerlIO * const fp = IoIFP(io) ? IoIFP(io) : IoOFP(io);
+	if (!fp) {
+	    SETERRNO(EBADF, RMS_IFI);
+	    return -1;
+	}
+	return PerlIO_fileno(fp);
+    }
+    return (int)SvIV(sv);
+}
+
+static int
+S_epoll_of(pTHX_ SV *self)
+{
+    if (!(SvROK(self) && sv_derived_from(self, "IO::EventPoll")))
+	croak("IO::EventPoll method called on a non-IO::EventPoll object");
+    return (int)SvIV(SvRV(self));
+}
+
+MODULE = IO::EventPoll		PACKAGE = IO::EventPoll
+
+PROTOTYPES: DISABLE
+
+BOOT:
+{
+    HV * const stash = gv_stashpvs("IO::EventPoll", GV_ADD);
+    newCONSTSUB(stash, "EPOLLIN", newSVuv(EPOLLIN));
+    newCONSTSUB(stash, "EPOLLOUT", newSVuv(EPOLLOUT));
+    newCONSTSUB(stash, "EPOLLPRI", newSVuv(EPOLLPRI));
+    newCONSTSUB(stash, "EPOLLERR", newSVuv(EPOLLERR));
+    newCONSTSUB(stash, "EPOLLHUP", newSVuv(EPOLLHUP));
+    newCONSTSUB(stash, "EPOLLRDHUP", newSVuv(EPOLLRDHUP));
+    newCONSTSUB(stash, "EPOLLET", newSVuv(EPOLLET));
+    newCONSTSUB(stash, "EPOLLONESHOT", newSVuv(EPOLLONESHOT));
+}
+
+SV *
+new(class)
+	const char *	class
+    PREINIT:
+	int fd;
+    CODE:
+#ifdef PERL_HAS_EPOLL
+#  ifdef EPOLL_CLOEXEC
+	fd = epoll_create1(EPOLL_CLOEXEC);
+#  else
+	/* The size hint is ignored by the kernel, but must be positive */
+	fd = epoll_create(1024);
+#    ifdef FD_CLOEXEC
+	if (fd >= 0)
+	    fcntl(fd, F_SETFD, FD_CLOEXEC);
+#    endif
+#  endif
+	if (fd < 0)
+	    XSRETURN_UNDEF;
+	RETVAL = sv_setref_iv(newSV(0), class, fd);
+#else
+	PERL_UNUSED_VAR(class);
+	PERL_UNUSED_VAR(fd);
+	not_here("new");
+	RETVAL = &PL_sv_undef;
+#endif
+    OUTPUT:
+	RETVAL
+
+int
+fileno(self)
+	SV *	self
+    CODE:
+	RETVAL = S_epoll_of(aTHX_ self);
+	if (RETVAL < 0)
+	    XSRETURN_UNDEF;
+    OUTPUT:
+	RETVAL
+
+SysRet
+add(self, fh, events = 0)
+	SV *	self
+	SV *	fh
+	U32	events
+    ALIAS:
+	add = EPOLL_CTL_ADD
+	modify = EPOLL_CTL_MOD
+	remove = EPOLL_CTL_DEL
+    PREINIT:
+	int epfd;
+	int fd;
+    CODE:
+	epfd = S_epoll_of(aTHX_ self);
+	fd = S_fd_of(aTHX_ fh);
+	if (epfd < 0 || fd < 0) {
+	    SETERRNO(EBADF, RMS_IFI);
+	    RETVAL = -1;
+	}
+	else {
+#ifdef PERL_HAS_EPOLL
+	    struct epoll_event ev;
+	    /* Kernels before 2.6.9 insist on an event even for removal */
+	    Zero(&ev, 1, struct epoll_event);
+	    ev.events = events;
+	    ev.data.fd = fd;
+	    RETVAL = epoll_ctl(epfd, ix, fd, &ev);
+#else
+	    PERL_UNUSED_VAR(events);
+	    RETVAL = not_here(GvNAME(CvGV(cv)));
+#endif
+	}
+    OUTPUT:
+	RETVAL
+
+void
+wait(self, timeout = &PL_sv_undef, maxevents = 256)
+	SV *	self
+	SV *	timeout
+	int	maxevents
+    PREINIT:
+	int epfd;
+	int ms = -1;
+    PPCODE:
+	epfd = S_epoll_of(aTHX_ self);
+	if (epfd < 0) {
+	    SETERRNO(EBADF, RMS_IFI);
+	    XSRETURN_EMPTY;
+	}
+	if (SvOK(timeout)) {
+	    const NV t = SvNV(timeout);
+	    /* Round up, so that a short timeout doesn't become a busy poll */
+	    if (t <= 0)
+		ms = 0;
+	    else if (t >= (NV)(I32_MAX / 1000))
+		ms = I32_MAX;
+	    else
+		ms = (int)(t * 1000.0 + 0.999);
+	}
+	if (maxevents < 1)
+	    maxevents = 1;
+	else if (maxevents > EPOLL_MAX_EVENTS)
+	    maxevents = EPOLL_MAX_EVENTS;
+#ifdef PERL_HAS_EPOLL
+	{
+	    struct epoll_event *ev;
+	    int n, i;
+
+	    Newx(ev, maxevents, struct epoll_event);
+	    n = epoll_wait(epfd, ev, maxevents, ms);
+	    if (n > 0) {
+		EXTEND(SP, 2 * n);
+		for (i = 0; i < n; i++) {
+		    mPUSHi(ev[i].data.fd);
+		    mPUSHu(ev[i].events);
+		}
+	    }
+	    Safefree(ev);
+	}
+#else
+	PERL_UNUSED_VAR(ms);
+	not_here("wait");
+#endif
+
+void
+DESTROY(self)
+	SV *	self
+    CODE:
+	if (SvROK(self)) {
+	    SV * const obj = SvRV(self);
+	    if (SvIOK(obj) && SvIVX(obj) >= 0) {
+		PerlLIO_close((int)SvIVX(obj));
+		SvIV_set(obj, -1);
+	    }
+	}
+
+void
+close(self)
+	SV *	self
+    PREINIT:
+	int fd;
+    PPCODE:
+	fd = S_epoll_of(aTHX_ self);
+	if (fd >= 0 && PerlLIO_close(fd) == 0) {
+	    sv_setiv(SvRV(self), -1);
+	    XSRETURN_YES;
+	}
+	if (fd < 0)
+	    SETERRNO(EBADF, RMS_IFI);
+	XSRETURN_NO;
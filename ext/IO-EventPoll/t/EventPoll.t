@@ -0,0 +1,67 @@
+#!./perl
+
+BEGIN {
+    require Config; import Config;
+    if ($Config{'extensions'} !~ /\bIO\/EventPoll\b/) {
+	print "1..0 # Skip: IO::EventPoll was not built\n";
+	exit 0;
+    }
+    if ($^O ne 'linux') {
+	print "1..0 # Skip: epoll is Linux only\n";
+	exit 0;
+    }
+}
+
+use strict;
+use warnings;
+use Test::More tests => 24;
+use IO::Handle;
+use Errno qw(EEXIST);
+
+BEGIN { use_ok('IO::EventPoll', qw(:constants)) }
+
+my $ep = IO::EventPoll->new;
+isa_ok($ep, 'IO::EventPoll');
+ok($ep->fileno > 2, 'has a descriptor of its own');
+
+pipe(my $r, my $w) or die "pipe: $!";
+$w->autoflush(1);
+
+ok($ep->add($r, EPOLLIN), 'add a glob ref');
+ok(!$ep->add($r, EPOLLIN), 'adding twice fails');
+ok($! == EEXIST, '... with EEXIST');
+
+my @ready = $ep->wait(0);
+is(scalar @ready, 0, 'nothing ready yet');
+
+print $w "x";
+my %ready = $ep->wait(1);
+is_deeply([keys %ready], [fileno $r], 'reader is ready');
+ok($ready{fileno $r} & EPOLLIN, '... for input');
+
+# The interest set persists between waits
+%ready = $ep->wait(1);
+ok(exists $ready{fileno $r}, 'still ready while unread');
+sysread($r, my $buf, 1);
+is($buf, 'x', 'read the byte');
+is(scalar(() = $ep->wait(0)), 0, 'not ready once drained');
+
+ok($ep->add(fileno($w), EPOLLOUT), 'add a bare descriptor');
+%ready = $ep->wait(1);
+is_deeply([keys %ready], [fileno $w], 'writer is ready');
+ok($ready{fileno $w} & EPOLLOUT, '... for output');
+
+ok($ep->modify($w, EPOLLIN), 'modify');
+is(scalar(() = $ep->wait(0)), 0, 'writer no longer reported');
+
+print $w "y";
+ok($ep->remove($r), 'remove');
+is(scalar(() = $ep->wait(0)), 0, 'removed handle is not reported');
+ok(!$ep->remove($r), 'removing twice fails');
+
+# Edge-triggered readiness is reported once per change
+ok($ep->add($r, EPOLLIN | EPOLLET), 'add edge-triggered');
+is(scalar(() = $ep->wait(0)), 2, 'reported on the first wait');
+is(scalar(() = $ep->wait(0)), 0, 'but not again without new data');
+
+ok($ep->close, 'close');
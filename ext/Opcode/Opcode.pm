@@ -6,7 +6,7 @@ use strict;
 
 our($VERSION, @ISA, @EXPORT_OK);
 
-$VERSION = "1.15";
+$VERSION = "1.16";
 
 use Carp;
 use Exporter ();
@@ -337,7 +337,7 @@ invert_opset function.
 
     rv2cv anoncode prototype
 
-    entersub leavesub leavesublv return method method_named -- XXX loops via recursion?
+    entersub leavesub leavesublv return method method_named inlinesub -- XXX loops via recursion?
 
     leaveeval -- needed for Safe to operate, is safe without entereval
 
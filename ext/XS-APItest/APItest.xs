@@ -549,6 +549,22 @@ sub CLEAR    { %{$_[0]} = () }
 
 =cut
 
+MODULE = XS::APItest::Array	PACKAGE = XS::APItest::Array
+
+I32
+max(av)
+	AV *av
+    CODE:
+	RETVAL = AvMAX(av);
+    OUTPUT:
+	RETVAL
+
+void
+shrink(av)
+	AV *av
+    CODE:
+	av_shrink(av);
+
 MODULE = XS::APItest::PtrTable	PACKAGE = XS::APItest::PtrTable PREFIX = ptr_table_
 
 void
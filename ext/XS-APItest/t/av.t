@@ -0,0 +1,67 @@
+#!perl -w
+use strict;
+
+use XS::APItest;
+use Test::More tests => 17;
+
+sub max { XS::APItest::Array::max($_[0]) }
+
+my @a;
+push @a, 1 .. 1000;
+is(max(\@a), 999, 'push of a list into an empty array presizes exactly');
+push @a, 1 .. 5000;
+is(max(\@a), 5999, '... and into a full one');
+
+my @b = (1 .. 10);
+my @c = map { ($_) x 3 } @b;
+is(max(\@c), 29, 'list assignment of map results presizes exactly');
+
+my @d;
+my $grows = 0;
+for (1 .. 10_000) {
+    my $max = max(\@d);
+    push @d, $_;
+    $grows++ if max(\@d) != $max;
+}
+cmp_ok($grows, '<', 40, 'pushing one at a time grows geometrically');
+cmp_ok(max(\@d), '>=', $#d, '... with room for every element');
+
+$#d = 99;
+cmp_ok(max(\@d), '>', 99, 'shortening keeps the space');
+XS::APItest::Array::shrink(\@d);
+is(max(\@d), 99, 'shrink gives back the space past the end');
+is_deeply(\@d, [1 .. 100], '... and keeps the elements');
+
+shift @d for 1 .. 50;
+XS::APItest::Array::shrink(\@d);
+is(max(\@d), 49, 'shrink gives back the space before the start');
+is_deeply(\@d, [51 .. 100], '... and keeps the elements');
+push @d, 101;
+is_deeply([@d[-2, -1]], [100, 101], 'a shrunk array can grow again');
+
+@d = ();
+XS::APItest::Array::shrink(\@d);
+is(max(\@d), -1, 'shrinking an empty array frees its storage');
+push @d, 'x';
+is("@d", 'x', '... and it can still be used');
+
+my @g = (1);
+XS::APItest::Array::shrink(\@g);
+push @g, 2;
+cmp_ok(max(\@g), '>=', 4, 'a small array grows by more than one element');
+
+my @e = (undef) x 3;
+$#e = 0;
+XS::APItest::Array::shrink(\@e);
+is(scalar(@e), 1, 'shrink does not change the length');
+
+require Tie::Array;
+tie my @t, 'Tie::StdArray';
+@t = (1, 2, 3);
+XS::APItest::Array::shrink(\@t);
+is("@t", '1 2 3', 'shrinking a tied array does nothing');
+
+my @f;
+$#f = 499;
+$#f = -1;
+is(max(\@f), 499, 'setting $#a presizes exactly');
@@ -42,4 +42,13 @@ is($t1->fetch($a), 0, 'Not found');
 is($t1->fetch($h), 0, 'Not found');
 is($t1->fetch($c), 0, 'Not found');
 
+# Enough entries to grow the table several times
+my @keys = map { [] } 1..5000;
+$t1->store($keys[$_], $keys[-1 - $_]) for 0..$#keys;
+is((grep { $t1->fetch($keys[$_]) != $keys[-1 - $_] } 0..$#keys), 0,
+   'All found after growing');
+$t1->store($keys[0], $a);
+cmp_ok($t1->fetch($keys[0]), '==', $a, 'Store replaces an existing entry');
+is($t1->fetch($h), 0, 'Not found');
+
 done_testing();
@@ -8,6 +8,23 @@ S_mro_get_linear_isa_c3(pTHX_ HV* stash, U32 level);
 static const struct mro_alg c3_alg =
     {S_mro_get_linear_isa_c3, "c3", 2, 0, 0};
 
+/* Copies a class name into a linearization.  A shared hash key scalar
+   costs no more than a reference count to copy again (into the
+   linearizations of subclasses), and comes with its hash value, so that
+   is what we make whenever we can.  */
+
+static SV *
+S_mro_class_name(pTHX_ SV *sv)
+{
+    if (SvIsCOW_shared_hash(sv))
+	return newSVhek(SvSHARED_HEK_FROM_PV(SvPVX_const(sv)));
+    if (SvPOK(sv) && !SvGMAGICAL(sv))
+	return newSVpvn_share(SvPVX_const(sv),
+			      SvUTF8(sv) ? -(I32)SvCUR(sv) : (I32)SvCUR(sv),
+			      0);
+    return newSVsv(sv);
+}
+
 /*
 =for apidoc mro_get_linear_isa_c3
 
@@ -83,7 +100,7 @@ S_mro_get_linear_isa_c3(pTHX_ HV* stash, U32 level)
                 /* if no stash, make a temporary fake MRO
                    containing just itself */
                 AV* const isa_lin = newAV();
-                av_push(isa_lin, newSVsv(isa_item));
+                av_push(isa_lin, S_mro_class_name(aTHX_ isa_item));
                 av_push(seqs, MUTABLE_SV(isa_lin));
             }
             else {
@@ -115,13 +132,11 @@ S_mro_get_linear_isa_c3(pTHX_ HV* stash, U32 level)
 		    *svp++ = newSVhek(stashhek);
 
 		    while(subrv_items--) {
-			/* These values are unlikely to be shared hash key
-			   scalars, so no point in adding code to optimising
-			   for a case that is unlikely to be true.
-			   (Or prove me wrong and do it.)  */
-
+			/* These are shared hash key scalars, unless someone
+			   has been at the array mro::get_linear_isa()
+			   returned.  */
 			SV *const val = *subrv_p++;
-			*svp++ = newSVsv(val);
+			*svp++ = S_mro_class_name(aTHX_ val);
 		    }
 
 		    SvREFCNT_inc(retval);
@@ -205,7 +220,7 @@ S_mro_get_linear_isa_c3(pTHX_ HV* stash, U32 level)
                        && (val = HeVAL(tail_entry))
                        && (SvIVX(val) > 0))
                            continue;
-                    winner = newSVsv(cand);
+                    winner = S_mro_class_name(aTHX_ cand);
                     av_push(retval, winner);
                     /* note however that even when we find a winner,
                        we continue looping over @seqs to do housekeeping */
@@ -263,7 +263,7 @@ Perl_gv_init(pTHX_ GV *gv, HV *stash, const char *name, STRLEN len, int multi)
 	}
 	LEAVE;
 
-        mro_method_changed_in(GvSTASH(gv)); /* sub Foo::bar($) { (shift) } sub ASDF::baz($); *ASDF::baz = \&Foo::bar */
+        gv_method_changed(gv); /* sub Foo::bar($) { (shift) } sub ASDF::baz($); *ASDF::baz = \&Foo::bar */
 	CvGV(GvCV(gv)) = gv;
 	CvFILE_set_from_cop(GvCV(gv), PL_curcop);
 	CvSTASH(GvCV(gv)) = PL_curstash;
@@ -691,6 +691,140 @@ Perl_gv_fetchmethod_flags(pTHX_ HV *stash, const char *name, U32 flags)
     return gv;
 }
 
+/* The inline method cache of method_named ops.  pp_method_named asks
+ * method_cache_fetch() before looking anything up, and hands the glob of
+ * the method's name in the object's stash to method_cache_store() once a
+ * lookup has left the method (or the stash's cache of it) there.  The
+ * cache hangs off the op's method name SV (which is in the pad under
+ * ithreads, so every thread gets its own), and holds up to
+ * METHOD_CACHE_SIZE stashes.  An entry is good only while the glob still
+ * has a CV, and PL_sub_generation and the stash's cache_gen and pkg_gen
+ * are what they were when it was made; everything that can change what a
+ * method call resolves to either bumps one of them or, through
+ * gv_method_changed(), empties the glob.
+ *
+ * The name is a shared hash key scalar, and upgrading one to hold magic
+ * would unshare it, so the first store replaces *methp with a PVMG that
+ * shares the same HEK instead.  */
+
+CV *
+Perl_method_cache_fetch(pTHX_ SV *meth, HV *stash)
+{
+    const MAGIC *mg;
+    const struct method_cache *mc;
+    const struct method_cache_entry *e;
+
+    PERL_ARGS_ASSERT_METHOD_CACHE_FETCH;
+
+    if (SvTYPE(meth) != SVt_PVMG || !(mg = SvMAGIC(meth))
+	|| mg->mg_virtual != &PL_vtbl_methcache)
+	return NULL;
+
+    mc = (const struct method_cache *)mg->mg_ptr;
+    for (e = mc->entry; e < mc->entry + METHOD_CACHE_SIZE; e++) {
+	if (e->stash == stash) {
+	    const struct mro_meta * const meta = HvMROMETA(stash);
+	    if (e->sub_gen == PL_sub_generation
+		&& e->stash_gen == meta->cache_gen + meta->pkg_gen
+		&& isGV_with_GP(e->gv))
+		return GvCV(e->gv);
+	    return NULL;
+	}
+    }
+    return NULL;
+}
+
+void
+Perl_method_cache_store(pTHX_ SV **methp, HV *stash, GV *gv)
+{
+    SV * const meth = *methp;
+    MAGIC *mg;
+    struct method_cache *mc;
+    struct method_cache_entry *e;
+    const struct mro_meta * const meta = HvMROMETA(stash);
+    HV *ostash;
+    GV *ogv;
+
+    PERL_ARGS_ASSERT_METHOD_CACHE_STORE;
+
+    if (SvTYPE(meth) == SVt_PVMG && (mg = SvMAGIC(meth))
+	&& mg->mg_virtual == &PL_vtbl_methcache)
+	mc = (struct method_cache *)mg->mg_ptr;
+    else if (SvTYPE(meth) != SVt_PV || !SvIsCOW_shared_hash(meth))
+	return;
+    else {
+	SV * const nsv = newSV_type(SVt_PVMG);
+
+	SvPV_set(nsv, HEK_KEY(share_hek_hek(
+			  SvSHARED_HEK_FROM_PV(SvPVX_const(meth)))));
+	SvCUR_set(nsv, SvCUR(meth));
+	SvLEN_set(nsv, 0);
+	SvFLAGS(nsv) |= SvFLAGS(meth) & ~SVTYPEMASK;
+	*methp = nsv;
+	/* the caller may still be looking at the old one */
+	sv_2mortal(meth);
+
+	mg = sv_magicext(nsv, NULL, PERL_MAGIC_ext, &PL_vtbl_methcache,
+			 NULL, 0);
+	Newxz(mc, 1, struct method_cache);
+	mg->mg_ptr = (char *)mc;
+	mg->mg_len = sizeof(struct method_cache);
+	mg->mg_flags |= MGf_DUP;
+    }
+
+    /* Reuse the stash's own entry, otherwise replace in turn */
+    for (e = mc->entry; e < mc->entry + METHOD_CACHE_SIZE; e++)
+	if (e->stash == stash)
+	    break;
+    if (e == mc->entry + METHOD_CACHE_SIZE) {
+	e = mc->entry + mc->next;
+	mc->next = (mc->next + 1) % METHOD_CACHE_SIZE;
+    }
+
+    ostash = e->stash;
+    ogv = e->gv;
+    e->stash = MUTABLE_HV(SvREFCNT_inc_simple_NN(stash));
+    e->gv = MUTABLE_GV(SvREFCNT_inc_simple_NN(gv));
+    e->sub_gen = PL_sub_generation;
+    e->stash_gen = meta->cache_gen + meta->pkg_gen;
+    SvREFCNT_dec(ostash);
+    SvREFCNT_dec(ogv);
+}
+
+int
+Perl_magic_freemethcache(pTHX_ SV *sv, MAGIC *mg)
+{
+    struct method_cache * const mc = (struct method_cache *)mg->mg_ptr;
+    PERL_UNUSED_ARG(sv);
+
+    PERL_ARGS_ASSERT_MAGIC_FREEMETHCACHE;
+
+    if (mc) {
+	struct method_cache_entry *e;
+	for (e = mc->entry; e < mc->entry + METHOD_CACHE_SIZE; e++) {
+	    SvREFCNT_dec(e->stash);
+	    SvREFCNT_dec(e->gv);
+	    e->stash = NULL;
+	    e->gv = NULL;
+	}
+    }
+    return 0;
+}
+
+#ifdef USE_ITHREADS
+int
+Perl_magic_dupmethcache(pTHX_ MAGIC *mg, CLONE_PARAMS *param)
+{
+    PERL_UNUSED_ARG(param);
+
+    PERL_ARGS_ASSERT_MAGIC_DUPMETHCACHE;
+
+    /* mg_dup() copied the parent's entries; start the new thread empty */
+    Zero(mg->mg_ptr, 1, struct method_cache);
+    return 0;
+}
+#endif
+
 GV*
 Perl_gv_autoload4(pTHX_ HV *stash, const char *name, STRLEN len, I32 method)
 {
@@ -2223,15 +2357,17 @@ Perl_amagic_call(pTHX_ SV *left, SV *right, int method, int flags)
     SV* res;
     const bool oldcatch = CATCH_GET;
 
+    OP * const oldop = PL_op;
+
     CATCH_SET(TRUE);
     Zero(&myop, 1, BINOP);
     myop.op_last = (OP *) &myop;
     myop.op_next = NULL;
     myop.op_flags = OPf_WANT_SCALAR | OPf_STACKED;
 
+    /* No ENTER/SAVEOP: PL_op is put back below, and on a die the
+     * unwinding sets it for wherever execution resumes. */
     PUSHSTACKi(PERLSI_OVERLOAD);
-    ENTER;
-    SAVEOP();
     PL_op = (OP *) &myop;
     if (PERLDB_SUB && PL_curstash != PL_debstash)
 	PL_op->op_private |= OPpENTERSUB_DB;
@@ -2251,7 +2387,7 @@ Perl_amagic_call(pTHX_ SV *left, SV *right, int method, int flags)
 
     if ((PL_op = PL_ppaddr[OP_ENTERSUB](aTHX)))
       CALLRUNOPS(aTHX);
-    LEAVE;
+    PL_op = oldop;
     SPAGAIN;
 
     res=POPs;
@@ -208,6 +208,27 @@ Return the SV from the GV.
 #define gv_efullname3(sv,gv,prefix) gv_efullname4(sv,gv,prefix,TRUE)
 #define gv_fetchmethod(stash, name) gv_fetchmethod_autoload(stash, name, TRUE)
 
+/* The inline cache of a method_named op, kept as magic on the op's method
+ * name.  Each entry remembers the glob of that name in C<stash>, whose CV
+ * is the method or the stash's own cache of it, and is valid while neither
+ * PL_sub_generation nor the stash's own generations have moved on since.
+ * gv_method_changed() empties the cached CV instead of moving the
+ * generations on.
+ */
+#define METHOD_CACHE_SIZE	4
+
+struct method_cache_entry {
+    HV *	stash;		/* refcounted, so the address stays unique */
+    GV *	gv;		/* refcounted */
+    U32		sub_gen;	/* PL_sub_generation */
+    U32		stash_gen;	/* cache_gen + pkg_gen of the stash */
+};
+
+struct method_cache {
+    struct method_cache_entry entry[METHOD_CACHE_SIZE];
+    U32		next;		/* entry to replace when all are in use */
+};
+
 #define gv_AVadd(gv) gv_add_by_type((gv), SVt_PVAV)
 #define gv_HVadd(gv) gv_add_by_type((gv), SVt_PVHV)
 #define gv_IOadd(gv) gv_add_by_type((gv), SVt_PVIO)
@@ -1457,8 +1457,12 @@ Perl_hv_free_ent(pTHX_ HV *hv, register HE *entry)
     if (!entry)
 	return;
     val = HeVAL(entry);
-    if (HvNAME(hv) && anonymise_cv(HvNAME_HEK(hv), val) && GvCVu(val))
-	mro_method_changed_in(hv);
+    if (HvNAME(hv) && anonymise_cv(HvNAME_HEK(hv), val) && GvCVu(val)) {
+	if (GvSTASH(val) == hv)
+	    gv_method_changed(MUTABLE_GV(val));
+	else
+	    mro_method_changed_in(hv);
+    }
     SvREFCNT_dec(val);
     if (HeKLEN(entry) == HEf_SVKEY) {
 	SvREFCNT_dec(HeKEY_sv(entry));
@@ -1755,6 +1759,9 @@ S_hfreeentries(pTHX_ HV *hv)
                 SvREFCNT_dec(meta->isa);
                 Safefree(meta);
                 iter->xhv_mro_meta = NULL;
+                /* A new meta would count its generations from 0 again, so
+                   make sure no method cache can mistake it for this one */
+                PL_sub_generation++;
             }
 
 	    /* There are now no allocated pointers in the aux structure.  */
@@ -1919,6 +1926,29 @@ S_hv_auxinit(HV *hv) {
     return iter;
 }
 
+/* The iterator to use for hv.  Frozen hashes (see sv_freeze) are shared
+ * by every thread, so each interpreter keeps its own iterators for them,
+ * in PL_frozen_iters, instead of using the one in the hash. */
+
+static struct xpvhv_aux*
+S_hv_iter_aux(pTHX_ HV *hv) {
+    struct xpvhv_aux *iter;
+
+    PERL_ARGS_ASSERT_HV_ITER_AUX;
+
+    if (!SvFROZEN(hv))
+	return SvOOK(hv) ? HvAUX(hv) : hv_auxinit(hv);
+
+    if (!PL_frozen_iters)
+	PL_frozen_iters = ptr_table_new();
+    else if ((iter = (struct xpvhv_aux *)ptr_table_fetch(PL_frozen_iters, hv)))
+	return iter;
+    Newxz(iter, 1, struct xpvhv_aux);
+    iter->xhv_riter = -1;
+    ptr_table_store(PL_frozen_iters, hv, iter);
+    return iter;
+}
+
 /*
 =for apidoc hv_iterinit
 
@@ -1945,7 +1975,7 @@ Perl_hv_iterinit(pTHX_ HV *hv)
 	Perl_croak(aTHX_ "Bad hash");
 
     if (SvOOK(hv)) {
-	struct xpvhv_aux * const iter = HvAUX(hv);
+	struct xpvhv_aux * const iter = hv_iter_aux(hv);
 	HE * const entry = iter->xhv_eiter; /* HvEITER(hv) */
 	if (entry && HvLAZYDEL(hv)) {	/* was deleted earlier? */
 	    HvLAZYDEL_off(hv);
@@ -1970,7 +2000,7 @@ Perl_hv_riter_p(pTHX_ HV *hv) {
     if (!hv)
 	Perl_croak(aTHX_ "Bad hash");
 
-    iter = SvOOK(hv) ? HvAUX(hv) : hv_auxinit(hv);
+    iter = hv_iter_aux(hv);
     return &(iter->xhv_riter);
 }
 
@@ -1983,7 +2013,7 @@ Perl_hv_eiter_p(pTHX_ HV *hv) {
     if (!hv)
 	Perl_croak(aTHX_ "Bad hash");
 
-    iter = SvOOK(hv) ? HvAUX(hv) : hv_auxinit(hv);
+    iter = hv_iter_aux(hv);
     return &(iter->xhv_eiter);
 }
 
@@ -1997,7 +2027,7 @@ Perl_hv_riter_set(pTHX_ HV *hv, I32 riter) {
 	Perl_croak(aTHX_ "Bad hash");
 
     if (SvOOK(hv)) {
-	iter = HvAUX(hv);
+	iter = hv_iter_aux(hv);
     } else {
 	if (riter == -1)
 	    return;
@@ -2017,7 +2047,7 @@ Perl_hv_eiter_set(pTHX_ HV *hv, HE *eiter) {
 	Perl_croak(aTHX_ "Bad hash");
 
     if (SvOOK(hv)) {
-	iter = HvAUX(hv);
+	iter = hv_iter_aux(hv);
     } else {
 	/* 0 is the default so don't go malloc()ing a new structure just to
 	   hold 0.  */
@@ -2137,7 +2167,7 @@ Perl_hv_iternext_flags(pTHX_ HV *hv, I32 flags)
 	   with it.  */
 	hv_iterinit(hv);
     }
-    iter = HvAUX(hv);
+    iter = hv_iter_aux(hv);
 
     oldentry = entry = iter->xhv_eiter; /* HvEITER(hv) */
     if (SvMAGICAL(hv) && SvRMAGICAL(hv)) {
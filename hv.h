@@ -243,8 +243,11 @@ C<SV*>.
 #define HvEITER(hv)	(*Perl_hv_eiter_p(aTHX_ MUTABLE_HV(hv)))
 #define HvRITER_set(hv,r)	Perl_hv_riter_set(aTHX_ MUTABLE_HV(hv), r)
 #define HvEITER_set(hv,e)	Perl_hv_eiter_set(aTHX_ MUTABLE_HV(hv), e)
-#define HvRITER_get(hv)	(SvOOK(hv) ? HvAUX(hv)->xhv_riter : -1)
-#define HvEITER_get(hv)	(SvOOK(hv) ? HvAUX(hv)->xhv_eiter : NULL)
+/* Each thread has its own iterators for frozen hashes */
+#define HvRITER_get(hv)	(SvOOK(hv) ? SvFROZEN(hv) ? HvRITER(hv)		\
+				   : HvAUX(hv)->xhv_riter : -1)
+#define HvEITER_get(hv)	(SvOOK(hv) ? SvFROZEN(hv) ? HvEITER(hv)		\
+				   : HvAUX(hv)->xhv_eiter : NULL)
 #define HvNAME(hv)	HvNAME_get(hv)
 
 /* Checking that hv is a valid package stash is the
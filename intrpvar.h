@@ -722,6 +722,9 @@ PERLVARI(Isv_serial, U32, 0) /* SV serial number, used in sv.c */
    retrieve a C<struct mro_alg *>  */
 PERLVAR(Iregistered_mros, HV *)
 
+/* This interpreter's iterators for frozen hashes (see sv_freeze) */
+PERLVARI(Ifrozen_iters, PTR_TBL_t *, NULL)
+
 /* If you are adding a U8 or U16, check to see if there are 'Space' comments
  * above on where there are gaps which currently will be structure padding.  */
 
@@ -22,7 +22,7 @@ sub syscopy;
 sub cp;
 sub mv;
 
-$VERSION = '2.18';
+$VERSION = '2.19';
 
 require Exporter;
 @ISA = qw(Exporter);
@@ -249,14 +249,22 @@ sub copy {
     }
 
     $! = 0;
-    for (;;) {
-	my ($r, $w, $t);
-       defined($r = sysread($from_h, $buf, $size))
+    if ($closefrom && $closeto && defined &PerlIO::copy) {
+	# Both ends are our own files, so let the kernel move the data
+	# where it can rather than pulling it through $buf
+	defined(PerlIO::copy($from_h, $to_h))
 	    or goto fail_inner;
-	last unless $r;
-	for ($w = 0; $w < $r; $w += $t) {
-           $t = syswrite($to_h, $buf, $r - $w, $w)
+    }
+    else {
+	for (;;) {
+	    my ($r, $w, $t);
+	    defined($r = sysread($from_h, $buf, $size))
 		or goto fail_inner;
+	    last unless $r;
+	    for ($w = 0; $w < $r; $w += $t) {
+		$t = syswrite($to_h, $buf, $r - $w, $w)
+		    or goto fail_inner;
+	    }
 	}
     }
 
@@ -519,6 +527,10 @@ being written to the second file. The default buffer size depends
 upon the file, but will generally be the whole file (up to 2MB), or
 1k for filehandles that do not reference files (eg. sockets).
 
+When both arguments are file names the data is copied with
+C<PerlIO::copy> (see L<PerlIO>), which has the kernel move it where
+the operating system supports that, and the buffer size is not used.
+
 You may use the syntax C<use File::Copy "cp"> to get at the C<cp>
 alias for this function. The syntax is I<exactly> the same.  The
 behavior is nearly the same as well: as of version 2.15, <cp> will
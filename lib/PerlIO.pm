@@ -1,6 +1,6 @@
 package PerlIO;
 
-our $VERSION = '1.06';
+our $VERSION = '1.07';
 
 # Map layer name to package that defines it
 our %alias;
@@ -332,6 +332,27 @@ the fourth element a name again, and so forth.
 
 B<You may open your eyes now.>
 
+=head2 Copying between filehandles
+
+   my $copied = PerlIO::copy($from_fh, $to_fh);
+   my $copied = PerlIO::copy($from_fh, $to_fh, $length);
+
+Copies C<$length> bytes, or everything up to end of file if C<$length>
+is omitted or C<undef>, from C<$from_fh> to C<$to_fh>, and returns the
+number of bytes copied.  If a read or write fails, it returns C<undef>
+with C<$!> set, even though part of the data may have been copied, and
+the error flag of the handle that failed is set, so that closing it
+fails as well.
+Data already buffered on C<$from_fh> is written first, so C<PerlIO::copy>
+mixes safely with C<readline> and C<read> on the same handles.
+
+When neither handle has any layers which translate data (C<:crlf>,
+C<:encoding> and so on) between it and the file descriptor, the copy is
+done inside the kernel where the operating system supports it (on Linux
+with C<copy_file_range()>, C<sendfile()> or C<splice()>, whichever
+accepts the pair of files), so the data never passes through Perl.
+Otherwise it is read and written through the layers.
+
 =head1 AUTHOR
 
 Nick Ing-Simmons E<lt>nick@ing-simmons.netE<gt>
@@ -47,7 +47,7 @@ sub numify { 0 + "${$_[0]}" }	# Not needed, additional overhead
 package main;
 
 $| = 1;
-use Test::More tests => 1970;
+use Test::More tests => 1973;
 
 
 $a = new Oscalar "087";
@@ -1829,4 +1829,18 @@ foreach my $op (qw(<=> == != < <= > >=)) {
     }
 }
 
+{
+    # dying out of, and local() in, an overloaded method
+    package die_in_ovl;
+    our $g = 'global';
+    use overload '+' => sub { local $g = 'local';
+			      die "boom\n" if $_[1] == 2;
+			      $g . $_[1] };
+    my $obj = bless [];
+    my @r = map { my $r = eval { $obj + $_ }; defined $r ? $r : $@ } 1 .. 3;
+    main::is ("@r", "local1 boom\n local3", 'die from overloaded method');
+    main::is ($g, 'global', 'local in overloaded method is undone');
+    main::is ($obj + 4, 'local4', 'overloaded method after die');
+}
+
 # EOF
@@ -1,6 +1,6 @@
 package sort;
 
-our $VERSION = '2.01';
+our $VERSION = '2.02';
 
 # The hints for pp_sort are now stored in $^H{sort}; older versions
 # of perl used the global variable $sort::hints. -- rjh 2005-12-19
@@ -9,6 +9,7 @@ $sort::quicksort_bit   = 0x00000001;
 $sort::mergesort_bit   = 0x00000002;
 $sort::sort_bits       = 0x000000FF; # allow 256 different ones
 $sort::stable_bit      = 0x00000100;
+$sort::parallel_bit    = 0x00000200;
 
 use strict;
 
@@ -29,6 +30,8 @@ sub import {
 	    $^H{sort} |=  $sort::mergesort_bit;
 	} elsif ($_ eq 'stable') {
 	    $^H{sort} |=  $sort::stable_bit;
+	} elsif ($_ eq 'parallel') {
+	    $^H{sort} |=  $sort::parallel_bit;
 	} elsif ($_ eq 'defaults') {
 	    $^H{sort} =   0;
 	} else {
@@ -53,6 +56,8 @@ sub unimport {
 	    $^H{sort} &= ~$sort::sort_bits;
 	} elsif ($_ eq 'stable') {
 	    $^H{sort} &= ~$sort::stable_bit;
+	} elsif ($_ eq 'parallel') {
+	    $^H{sort} &= ~$sort::parallel_bit;
 	} else {
 	    require Carp;
 	    Carp::croak("sort: unknown subpragma '$_'");
@@ -68,6 +73,8 @@ sub current {
 	push @sort, 'stable'    if $^H{sort} & $sort::stable_bit;
     }
     push @sort, 'mergesort' unless @sort;
+    push @sort, 'parallel'
+	if $^H{sort} && $^H{sort} & $sort::parallel_bit;
     join(' ', @sort);
 }
 
@@ -83,6 +90,7 @@ sort - perl pragma to control sort() behaviour
     use sort 'stable';		# guarantee stability
     use sort '_quicksort';	# use a quicksort algorithm
     use sort '_mergesort';	# use a mergesort algorithm
+    use sort 'parallel';	# allow large sorts to use several threads
     use sort 'defaults';	# revert to default behavior
     no  sort 'stable';		# stability not important
 
@@ -136,6 +144,22 @@ say so with a
 
   use sort 'stable';
 
+With
+
+  use sort 'parallel';
+
+large lists (over about 130,000 elements) may be sorted on several
+threads at once, one per available CPU up to a maximum of eight.  This
+applies only to the plain numeric and string sorts that perl recognises
+and runs without calling any Perl code, that is no block at all,
+C<< { $a <=> $b } >>, C<{ $a cmp $b }> and their reverses, and only when
+every element is a plain number or string without magic or overloading,
+and (for string sorts) outside the scope of C<use locale>.  Otherwise the
+ordinary single-threaded sort is used.  The result is exactly the same
+either way, including the order of elements that compare equal.  This
+subpragma has an effect only on perls built with thread support; it is
+silently ignored elsewhere.
+
 The C<no sort> pragma doesn't
 I<forbid> what follows, it just leaves the choice open.  Thus, after
 
@@ -29,7 +29,8 @@ use Test::More tests => @TestSizes * 2	# sort() tests
 			* 6		# number of pragmas to test
 			+ 1 		# extra test for qsort instability
 			+ 3		# tests for sort::current
-			+ 3;		# tests for "defaults" and "no sort"
+			+ 3		# tests for "defaults" and "no sort"
+			+ 7;		# tests for "parallel"
 
 # Generate array of specified size for testing sort.
 #
@@ -179,3 +180,39 @@ main(sub { sort {&{$_[0]}} @{$_[1]} }, 0);
     is($sort_current, 'stable', 'sort::current after defaults stable');
     main(sub { sort {&{$_[0]}} @{$_[1]} }, 0);
 }
+
+# The parallel sort only kicks in for long lists; it must give exactly
+# the serial result, including the order of equal elements.
+
+{
+    my $size = 200_000;
+    # Numerically equal but distinguishable strings test stability
+    my @num = map { ("0" x ($_ % 3)) . int(rand(5000)) } 1 .. $size;
+    my @int = map { int(rand(1e9)) - 5e8 } 1 .. $size;
+    my @str = map { sprintf "%x", rand(1e6) } 1 .. $size;
+    my (@want_num, @want_ndesc, @want_int, @want_str, @want_sdesc);
+    {
+	no sort 'parallel';
+	@want_num   = sort { $a <=> $b } @num;
+	@want_ndesc = sort { $b <=> $a } @num;
+	@want_int   = sort { $a <=> $b } @int;
+	@want_str   = sort @str;
+	@want_sdesc = sort { $b cmp $a } @str;
+    }
+
+    use sort 'parallel';
+    my $sort_current; BEGIN { $sort_current = sort::current(); }
+    is($sort_current, 'mergesort parallel', 'sort::current for parallel');
+    is(checkequal([sort { $a <=> $b } @num], \@want_num), '',
+       'parallel numeric sort');
+    is(checkequal([sort { $b <=> $a } @num], \@want_ndesc), '',
+       'parallel descending numeric sort');
+    is(checkequal([sort { $a <=> $b } @int], \@want_int), '',
+       'parallel integer sort');
+    is(checkequal([sort @str], \@want_str), '', 'parallel string sort');
+    is(checkequal([sort { $b cmp $a } @str], \@want_sdesc), '',
+       'parallel descending string sort');
+    my @copy = @str;
+    @copy = sort @copy;
+    is(checkequal(\@copy, \@want_str), '', 'parallel in-place sort');
+}
@@ -0,0 +1,81 @@
+package tailcall;
+
+our $VERSION = '1.00';
+
+sub import {
+    $^H{tailcall} = 1;
+}
+
+sub unimport {
+    delete $^H{tailcall};
+}
+
+1;
+__END__
+
+=head1 NAME
+
+tailcall - Perl pragma to make calls in tail position reuse the caller's frame
+
+=head1 SYNOPSIS
+
+    use tailcall;
+
+    sub gcd {
+        my ($x, $y) = @_;
+        return $x unless $y;
+        return gcd($y, $x % $y);	# runs in constant stack
+    }
+
+    no tailcall;
+
+=head1 DESCRIPTION
+
+A subroutine call is in tail position when its results are everything
+the calling subroutine returns: the argument of a C<return>, or the
+final statement of the subroutine body.  Normally such a call still
+pushes a new context and, if it recurses, a new pad depth, only for the
+caller to pass the results straight on.
+
+Under C<use tailcall> a call with an argument list that is found in
+tail position at run time instead replaces the calling subroutine, just
+as C<goto &sub> does.  Deep recursion, mutual recursion between state
+functions, and recursive descent parsers then run in constant stack
+space, and the "Deep recursion" warning no longer fires for them.
+
+The pragma is lexically scoped.  It covers the C<return> statements
+compiled in its scope, and the final statements of the subroutines
+defined in its scope.
+
+=head2 Differences from ordinary calls
+
+As with C<goto &sub>, the calling subroutine is gone by the time the
+callee runs:
+
+=over 4
+
+=item *
+
+Changes made with C<local> in the caller are undone before the callee
+is entered.
+
+=item *
+
+C<caller> from the callee reports the caller's caller, and the caller
+does not appear in stack traces.
+
+=item *
+
+Arguments that are temporary values, such as the result of C<$n - 1>,
+are passed as copies.  Variables and elements are still aliased by
+C<@_>.
+
+=back
+
+A call is made the ordinary way when it is not in tail position at run
+time: when other values are returned along with its results, when it
+is made in a different context from the caller's own call, inside an
+C<eval>, a sort block, an lvalue subroutine or a subroutine called as
+C<&foo;>, under the debugger, and for XSUBs.
+
+=cut
@@ -0,0 +1,104 @@
+#!./perl
+
+BEGIN {
+    chdir 't' if -d 't';
+    @INC = '../lib';
+}
+
+use strict;
+use warnings;
+
+use Test::More tests => 19;
+
+sub depth { my $d = 0; $d++ while caller($d); $d }
+
+my @warnings;
+$SIG{__WARN__} = sub { push @warnings, @_ };
+
+{
+    use tailcall;
+
+    sub count_down {
+	my ($n, $max) = @_;
+	$max = depth() if !defined $max || depth() > $max;
+	return $max unless $n;
+	return count_down($n - 1, $max);
+    }
+
+    sub is_even { my $n = shift; $n ? is_odd($n - 1) : 1 }
+    sub is_odd  { my $n = shift; $n ? is_even($n - 1) : 0 }
+
+    sub sum_to {
+	my ($n, $acc) = @_;
+	return $acc if !$n;
+	sum_to($n - 1, $acc + $n);
+    }
+
+    sub in_loop {
+	my $n = shift;
+	for my $i (1 .. 2) {
+	    return in_loop($n - 1) if $n;
+	}
+	my $depth = depth();	# not a tail call itself
+	return $depth;
+    }
+
+    sub with_extra { my $n = shift; return $n unless $n; return ($n, with_extra($n - 1)) }
+    sub context { my $n = shift; return $n ? context($n - 1) : wantarray }
+    sub scalar_of { return scalar(list3()) }
+    sub list3 { return (7, 8, 9) }
+    sub modify { $_[0] = "changed"; return }
+    sub pass_on { return modify($_[0]) }
+    sub lexical { my $x = "lex" . shift; return identity($x) }
+    sub identity { return $_[0] }
+    sub called_by { return who_called() }
+    sub who_called { return (caller(1))[3] }
+    sub in_eval { my $n = shift; return depth() + 0 unless $n; eval { return in_eval($n - 1) } }
+    sub ampersand { my $n = shift; return depth() unless $n; unshift @_, $n - 1; return &ampersand }
+}
+
+sub plain { my $n = shift; return depth() unless $n; return plain($n - 1) }
+
+my $base = depth() + 1;
+is(count_down(10), $base, 'self recursion runs in one frame');
+is(count_down(100_000), $base, '... however deep');
+ok(is_even(100_001) == 0 && is_odd(100_001) == 1, 'mutual recursion');
+is(sum_to(50_000, 0), 1_250_025_000, 'tail call as the final statement');
+is(in_loop(5), $base, 'return from inside a loop');
+is_deeply([with_extra(3)], [3, 2, 1, 0], 'other values are returned too');
+is(plain(5), $base + 5, 'no tail calls outside the pragma');
+ok(!grep(/Deep recursion/, @warnings), 'no deep recursion warnings')
+    or diag(@warnings);
+
+is(scalar(context(3)), '', 'scalar context is kept');
+is((context(3))[0], 1, 'list context is kept');
+is((scalar_of())[0], 9, 'calls made in another context are not tail calls');
+is(lexical("ical"), "lexical", 'lexicals of the caller are passed on');
+
+my $var = "orig";
+pass_on($var);
+is($var, "changed", 'arguments are still aliased');
+
+is(called_by(), undef, 'the caller has left the call stack');
+
+is(in_eval(3), $base + 6, 'no tail calls out of an eval');
+is(ampersand(3), $base + 3, 'no tail calls from &foo; calls');
+
+{
+    use tailcall;
+    my $closure;
+    $closure = sub { my $n = shift; return $n ? $closure->($n - 1) : depth() + 0 };
+    is($closure->(1000), $base, 'calls through code references');
+
+    no tailcall;
+    my $nested;
+    $nested = sub { my $n = shift; return $n ? $nested->($n - 1) : depth() };
+    is($nested->(3), $base + 3, 'no tailcall turns them off');
+}
+
+{
+    use tailcall;
+    sub localised { our $global = "local"; local $global = "changed"; return see_global() }
+    sub see_global { our $global }
+}
+is(localised(), 'local', 'local is undone before the tail call');
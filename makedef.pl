@@ -597,6 +597,8 @@ elsif ($PLATFORM eq 'netware') {
 			Perl_sys_intern_clear
 			Perl_my_bcopy
 			Perl_PerlIO_write
+			Perl_PerlIO_writev
+			Perl_PerlIO_copy
 			Perl_PerlIO_unread
 			Perl_PerlIO_tell
 			Perl_PerlIO_stdout
@@ -1022,6 +1024,7 @@ my @layer_syms = qw(
 		    PerlIOBase_read
 		    PerlIOBase_setlinebuf
 		    PerlIOBase_unread
+		    PerlIOBase_writev
 		    PerlIOBuf_bufsiz
 		    PerlIOBuf_close
 		    PerlIOBuf_dup
@@ -1039,6 +1042,7 @@ my @layer_syms = qw(
 		    PerlIOBuf_tell
 		    PerlIOBuf_unread
 		    PerlIOBuf_write
+		    PerlIOBuf_writev
 		    PerlIO_allocate
 		    PerlIO_apply_layera
 		    PerlIO_apply_layers
@@ -1060,6 +1064,7 @@ my @layer_syms = qw(
 		    Perl_PerlIO_clearerr
 		    Perl_PerlIO_close
 		    Perl_PerlIO_context_layers
+		    Perl_PerlIO_copy
 		    Perl_PerlIO_eof
 		    Perl_PerlIO_error
 		    Perl_PerlIO_fileno
@@ -1080,6 +1085,7 @@ my @layer_syms = qw(
 		    Perl_PerlIO_tell
 		    Perl_PerlIO_unread
 		    Perl_PerlIO_write
+		    Perl_PerlIO_writev
 );
 if ($PLATFORM eq 'netware') {
     push(@layer_syms,'PL_def_layerlist','PL_known_layers','PL_perlio');
@@ -1144,6 +1150,7 @@ if ($define{'USE_PERLIO'}) {
 			 PerlIO_perlio
 			 Perl_PerlIO_clearerr
 			 Perl_PerlIO_close
+			 Perl_PerlIO_copy
 			 Perl_PerlIO_eof
 			 Perl_PerlIO_error
 			 Perl_PerlIO_fileno
@@ -1164,6 +1171,7 @@ if ($define{'USE_PERLIO'}) {
 			 Perl_PerlIO_tell
 			 Perl_PerlIO_unread
 			 Perl_PerlIO_write
+			 Perl_PerlIO_writev
                          PL_def_layerlist
                          PL_known_layers
                          PL_perlio
@@ -580,6 +580,66 @@ via, C<mro::method_changed_in(classname)>.
 */
 void
 Perl_mro_method_changed_in(pTHX_ HV *stash)
+{
+    PERL_ARGS_ASSERT_MRO_METHOD_CHANGED_IN;
+
+    mro_method_changed(stash, NULL);
+}
+
+/*
+=for apidoc gv_method_changed
+
+Like C<mro_method_changed_in>, for a change to the method in the given
+glob only.  Rather than invalidating every method cache of every child
+class, it drops only the cached resolutions of that one name, so that
+installing a method at runtime does not make a whole class hierarchy
+look its methods up again.
+
+Falls back to C<mro_method_changed_in> for names that the overload
+tables depend upon, and for globs that share their body with another
+(and so may change under other names too).
+
+=cut
+*/
+void
+Perl_gv_method_changed(pTHX_ GV *gv)
+{
+    const char * const name = GvNAME(gv);
+    const STRLEN len = GvNAMELEN(gv);
+
+    PERL_ARGS_ASSERT_GV_METHOD_CHANGED;
+
+    /* The overload tables, including the DESTROY entry (which may be
+       AUTOLOADed), are only checked against the generation counts */
+    if (GvREFCNT(gv) > 1 || *name == '('
+	|| (len == 7 && strEQ(name, "DESTROY"))
+	|| (len == 8 && strEQ(name, "AUTOLOAD")))
+	mro_method_changed(GvSTASH(gv), NULL);
+    else
+	mro_method_changed(GvSTASH(gv), gv);
+}
+
+/* Whether the overload table of C<stash> is in use.  It may name its
+   methods, which are then resolved when the table is built, and it is
+   rebuilt only when the generation counts change.  */
+
+STATIC bool
+S_mro_overloaded(pTHX_ HV *stash)
+{
+    const MAGIC * const mg = SvRMAGICAL(stash)
+	? mg_find((const SV *)stash, PERL_MAGIC_overload_table) : NULL;
+
+    PERL_ARGS_ASSERT_MRO_OVERLOADED;
+
+    return mg && AMT_OVERLOADED((const AMT *)mg->mg_ptr);
+}
+
+/* Invalidates the method caches of the child classes of C<stash>: all of
+   them, or only those for the name of C<gv> if it is given (but still all
+   of them in the children with overloading).  */
+
+STATIC void
+S_mro_method_changed(pTHX_ HV *stash, const GV *gv)
 {
     const char * const stashname = HvNAME_get(stash);
     const STRLEN stashname_len = HvNAMELEN_get(stash);
@@ -587,7 +647,7 @@ Perl_mro_method_changed_in(pTHX_ HV *stash)
     SV ** const svp = hv_fetch(PL_isarev, stashname, stashname_len, 0);
     HV * const isarev = svp ? MUTABLE_HV(*svp) : NULL;
 
-    PERL_ARGS_ASSERT_MRO_METHOD_CHANGED_IN;
+    PERL_ARGS_ASSERT_MRO_METHOD_CHANGED;
 
     if(!stashname)
         Perl_croak(aTHX_ "Can't call mro_method_changed_in() on anonymous symbol table");
@@ -617,9 +677,23 @@ Perl_mro_method_changed_in(pTHX_ HV *stash)
 
             if(!revstash) continue;
             mrometa = HvMROMETA(revstash);
-            mrometa->cache_gen++;
             if(mrometa->mro_nextmethod)
                 hv_clear(mrometa->mro_nextmethod);
+            if(gv && !mro_overloaded(revstash)) {
+                /* Only the child's cache entry for this name (or for its
+                   absence) can be out of date; genuine methods defined in
+                   the child itself are left alone */
+                SV ** const gvp = hv_fetch(revstash, GvNAME(gv),
+                                           GvNAMELEN(gv), 0);
+                GV * const revgv = gvp ? MUTABLE_GV(*gvp) : NULL;
+                if(revgv && isGV_with_GP(revgv) && GvCVGEN(revgv)) {
+                    SvREFCNT_dec(GvCV(revgv));
+                    GvCV(revgv) = NULL;
+                    GvCVGEN(revgv) = 0;
+                }
+            }
+            else
+                mrometa->cache_gen++;
         }
     }
 }
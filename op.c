@@ -905,6 +905,7 @@ Perl_scalar(pTHX_ OP *o)
     case OP_OR:
     case OP_AND:
     case OP_COND_EXPR:
+    case OP_INLINESUB:
 	for (kid = cUNOPo->op_first->op_sibling; kid; kid = kid->op_sibling)
 	    scalar(kid);
 	break;
@@ -1210,6 +1211,13 @@ Perl_scalarvoid(pTHX_ OP *o)
 	    scalarvoid(kid);
 	break;
 
+    case OP_INLINESUB:
+	/* A call in void context doesn't warn, so neither may its copy */
+	kid = cUNOPo->op_first->op_sibling;
+	scalar(kid);
+	scalarvoid(kid->op_sibling);
+	break;
+
     case OP_NULL:
 	if (o->op_flags & OPf_STACKED)
 	    break;
@@ -1284,6 +1292,7 @@ Perl_list(pTHX_ OP *o)
     case OP_OR:
     case OP_AND:
     case OP_COND_EXPR:
+    case OP_INLINESUB:
 	for (kid = cUNOPo->op_first->op_sibling; kid; kid = kid->op_sibling)
 	    list(kid);
 	break;
@@ -1567,6 +1576,13 @@ Perl_mod(pTHX_ OP *o, I32 type)
 	    mod(kid, type);
 	break;
 
+    case OP_INLINESUB:
+	/* The inlined copy yields the arguments and elements themselves,
+	   where the sub would return copies of them */
+	o->op_private |= OPpINLINE_CALL;
+	mod(cUNOPo->op_first->op_sibling->op_sibling, type);
+	return o;
+
     case OP_RV2AV:
     case OP_RV2HV:
 	if (type == OP_REFGEN && o->op_flags & OPf_PARENS) {
@@ -1845,6 +1861,10 @@ Perl_doref(pTHX_ OP *o, I32 type, bool set_op_ref)
 	for (kid = cUNOPo->op_first->op_sibling; kid; kid = kid->op_sibling)
 	    doref(kid, type, set_op_ref);
 	break;
+    case OP_INLINESUB:
+	o->op_private |= OPpINLINE_CALL;
+	doref(cUNOPo->op_first->op_sibling->op_sibling, type, set_op_ref);
+	break;
     case OP_RV2SV:
 	if (type == OP_DEFINED)
 	    o->op_flags |= OPf_SPECIAL;		/* don't create GV */
@@ -5836,7 +5856,7 @@ Perl_newATTRSUB(pTHX_ I32 floor, OP *o, OP *proto, OP *attrs, OP *block)
 		}
 	    }
 	    GvCVGEN(gv) = 0;
-            mro_method_changed_in(GvSTASH(gv)); /* sub Foo::bar { (shift)+1 } */
+            gv_method_changed(gv); /* sub Foo::bar { (shift)+1 } */
 	}
     }
     if (!CvGV(cv)) {
@@ -5901,6 +5921,8 @@ Perl_newATTRSUB(pTHX_ I32 floor, OP *o, OP *proto, OP *attrs, OP *block)
 	else
 	    block->op_attached = 1;
 	CvROOT(cv) = newUNOP(OP_LEAVESUB, 0, scalarseq(block));
+	if (tailcalls_enabled())
+	    CvROOT(cv)->op_private |= OPpTAILCALL;
     }
     CvROOT(cv)->op_private |= OPpREFCOUNTED;
     OpREFCNT_set(CvROOT(cv), 1);
@@ -6197,7 +6219,7 @@ Perl_newXS(pTHX_ const char *name, XSUBADDR_t subaddr, const char *filename)
 	if (name) {
 	    GvCV(gv) = cv;
 	    GvCVGEN(gv) = 0;
-            mro_method_changed_in(GvSTASH(gv)); /* newXS */
+            gv_method_changed(gv); /* newXS */
 	}
     }
     CvGV(cv) = gv;
@@ -7690,6 +7712,16 @@ Perl_ck_require(pTHX_ OP *o)
     return scalar(ck_fun(o));
 }
 
+/* Whether "use tailcall" is in effect for the code being compiled */
+
+STATIC bool
+S_tailcalls_enabled(pTHX)
+{
+    HV * const hinthv = GvHV(PL_hintgv);
+    return (PL_hints & HINT_LOCALIZE_HH) && hinthv
+	&& hv_exists(hinthv, "tailcall", 8);
+}
+
 OP *
 Perl_ck_return(pTHX_ OP *o)
 {
@@ -7698,6 +7730,8 @@ Perl_ck_return(pTHX_ OP *o)
 
     PERL_ARGS_ASSERT_CK_RETURN;
 
+    if (tailcalls_enabled())
+	o->op_private |= OPpTAILCALL;
     kid = cLISTOPo->op_first->op_sibling;
     if (CvLVALUE(PL_compcv)) {
 	for (; kid; kid = kid->op_sibling)
@@ -7792,6 +7826,8 @@ Perl_ck_sort(pTHX_ OP *o)
 		    o->op_private |= OPpSORT_QSORT;
 		if ((sorthints & HINT_SORT_STABLE) != 0)
 		    o->op_private |= OPpSORT_STABLE;
+		if ((sorthints & HINT_SORT_PARALLEL) != 0)
+		    o->op_private |= OPpSORT_PARALLEL;
 	    }
 	}
     }
@@ -8010,6 +8046,320 @@ Perl_ck_join(pTHX_ OP *o)
     return ck_fun(o);
 }
 
+/* The sub and argument a call inlined by S_inline_sub refers to are
+ * found in the pad of the sub being inlined and the operands of the call
+ * respectively. */
+
+#ifdef USE_ITHREADS
+#  define INLINE_GV(o, cv) \
+	((GV*)AvARRAY(MUTABLE_AV(AvARRAY(CvPADLIST(cv))[1]))		\
+	    [cPADOPx(o)->op_padix])
+#else
+#  define INLINE_GV(o, cv)	cGVOPx_gv(o)
+#endif
+
+#define INLINE_HINTS	(HINT_INTEGER|HINT_STRICT_REFS|HINT_LOCALE|HINT_BYTES \
+			 |HINT_NO_AMAGIC)
+
+/* Copy argument ix of an inlined call.  Only lexicals and constants are
+ * copied: reading them again in place of $_[ix] is indistinguishable
+ * from reading them through @_. */
+
+STATIC OP *
+S_inline_arg(pTHX_ OP *args, I32 nargs, IV ix, bool deref)
+{
+    OP *o;
+
+    PERL_ARGS_ASSERT_INLINE_ARG;
+
+    if (ix < 0 || ix >= nargs)
+	return NULL;
+    while (ix--)
+	args = args->op_sibling;
+    if (args->op_type == OP_PADSV) {
+	o = newOP(OP_PADSV, 0);
+	o->op_targ = args->op_targ;
+	return o;
+    }
+    if (deref)
+	return NULL;
+    return newSVOP(OP_CONST, 0, SvREFCNT_inc_simple_NN(cSVOPx_sv(args)));
+}
+
+/* Copy the expression o from the body of cv into the sub being compiled,
+ * with the arguments of the call in place of $_[N].  Only side-effect free
+ * operators are copied, so that the copy computes what the call would
+ * have.  deref is set if the parent expression dereferences o.
+ * Returns NULL if the expression can't be copied. */
+
+STATIC OP *
+S_inline_expr(pTHX_ const OP *o, CV *cv, OP *args, I32 nargs, bool deref)
+{
+    dVAR;
+    const OP *kid;
+    OP *first;
+    OP *last;
+    SV *sv;
+
+    PERL_ARGS_ASSERT_INLINE_EXPR;
+
+    switch (o->op_type) {
+    case OP_NULL:
+	/* $_[N], which the peephole optimiser made an aelemfast */
+	if (o->op_targ != OP_AELEM)
+	    return NULL;
+	kid = cUNOPo->op_first;
+	if (kid->op_type != OP_NULL || !(kid->op_flags & OPf_KIDS))
+	    return NULL;
+	kid = cUNOPx(kid)->op_first;
+	if (kid->op_type != OP_AELEMFAST || (kid->op_flags & OPf_SPECIAL)
+	    || INLINE_GV(kid, cv) != PL_defgv)
+	    return NULL;
+	return inline_arg(args, nargs, (I8)kid->op_private, deref);
+
+    case OP_AELEM:
+	if (o->op_private & (OPpLVAL_INTRO|OPpLVAL_DEFER|OPpMAYBE_LVSUB))
+	    return NULL;
+	kid = cBINOPo->op_first;
+	if (kid->op_type != OP_RV2AV || !(kid->op_flags & OPf_KIDS))
+	    return NULL;
+	kid = cUNOPx(kid)->op_first;
+	if (kid->op_type == OP_GV) {
+	    /* $_[N], dereferenced */
+	    if (INLINE_GV(kid, cv) != PL_defgv
+		|| cBINOPo->op_last->op_type != OP_CONST)
+		return NULL;
+	    sv = cSVOPx(cBINOPo->op_last)->op_sv;
+	    if (!sv)
+		sv = PAD_BASE_SV(CvPADLIST(cv), cBINOPo->op_last->op_targ);
+	    return inline_arg(args, nargs, SvIV(sv), deref);
+	}
+	if (!(first = inline_expr(kid, cv, args, nargs, TRUE)))
+	    return NULL;
+	if (!(last = inline_expr(cBINOPo->op_last, cv, args, nargs, FALSE))) {
+	    op_free(first);
+	    return NULL;
+	}
+	return newBINOP(OP_AELEM, 0, ref(newAVREF(first), OP_RV2AV),
+			scalar(last));
+
+    case OP_HELEM:
+	if (o->op_private & (OPpLVAL_INTRO|OPpLVAL_DEFER|OPpMAYBE_LVSUB))
+	    return NULL;
+	kid = cBINOPo->op_first;
+	if (kid->op_type != OP_RV2HV || !(kid->op_flags & OPf_KIDS))
+	    return NULL;
+	if (!(first = inline_expr(cUNOPx(kid)->op_first, cv, args, nargs,
+				  TRUE)))
+	    return NULL;
+	if (!(last = inline_expr(cBINOPo->op_last, cv, args, nargs, FALSE))) {
+	    op_free(first);
+	    return NULL;
+	}
+	return newBINOP(OP_HELEM, 0, ref(newHVREF(first), OP_RV2HV),
+			scalar(last));
+
+    case OP_CONST:
+	if (deref)
+	    return NULL;
+	sv = cSVOPo->op_sv;
+	if (!sv)
+	    sv = PAD_BASE_SV(CvPADLIST(cv), o->op_targ);
+	return newSVOP(OP_CONST, 0, SvREFCNT_inc_simple_NN(sv));
+
+    case OP_NEGATE:
+    case OP_I_NEGATE:
+    case OP_NOT:
+    case OP_COMPLEMENT:
+    case OP_INT:
+    case OP_ABS:
+	if (deref || !(o->op_flags & OPf_KIDS)
+	    || (o->op_private & OPpTARGET_MY))
+	    return NULL;
+	if (!(first = inline_expr(cUNOPo->op_first, cv, args, nargs, FALSE)))
+	    return NULL;
+	return newUNOP(o->op_type, 0, scalar(first));
+
+    case OP_ADD:	case OP_I_ADD:
+    case OP_SUBTRACT:	case OP_I_SUBTRACT:
+    case OP_MULTIPLY:	case OP_I_MULTIPLY:
+    case OP_DIVIDE:	case OP_I_DIVIDE:
+    case OP_MODULO:	case OP_I_MODULO:
+    case OP_POW:	case OP_CONCAT:
+    case OP_LT:		case OP_I_LT:
+    case OP_GT:		case OP_I_GT:
+    case OP_LE:		case OP_I_LE:
+    case OP_GE:		case OP_I_GE:
+    case OP_EQ:		case OP_I_EQ:
+    case OP_NE:		case OP_I_NE:
+    case OP_NCMP:	case OP_I_NCMP:
+    case OP_SLT:	case OP_SGT:
+    case OP_SLE:	case OP_SGE:
+    case OP_SEQ:	case OP_SNE:
+    case OP_SCMP:
+    case OP_BIT_AND:	case OP_BIT_OR:
+    case OP_BIT_XOR:
+    case OP_LEFT_SHIFT:	case OP_RIGHT_SHIFT:
+	if (deref || (o->op_flags & OPf_STACKED)
+	    || (o->op_private & OPpTARGET_MY))
+	    return NULL;
+	if (!(first = inline_expr(cBINOPo->op_first, cv, args, nargs, FALSE)))
+	    return NULL;
+	if (!(last = inline_expr(cBINOPo->op_last, cv, args, nargs, FALSE))) {
+	    op_free(first);
+	    return NULL;
+	}
+	return newBINOP(o->op_type, 0, scalar(first), scalar(last));
+
+    default:
+	return NULL;
+    }
+}
+
+/* Copy the statement of a sub being inlined, for the copy of its body to
+ * run under, so that errors and warnings from it name the sub's file and
+ * line as the call would have. */
+
+STATIC OP *
+S_inline_cop(pTHX_ const COP *from)
+{
+    dVAR;
+    COP *cop;
+
+    PERL_ARGS_ASSERT_INLINE_COP;
+
+    NewOp(1101, cop, 1, COP);
+    cop->op_type = OP_NEXTSTATE;
+    cop->op_ppaddr = PL_ppaddr[OP_NEXTSTATE];
+    cop->op_private = from->op_private;
+    cop->op_next = (OP*)cop;
+    CopHINTS_set(cop, CopHINTS_get(from));
+    cop->cop_seq = PL_cop_seqmax;
+    cop->cop_warnings = DUP_WARNINGS(from->cop_warnings);
+    cop->cop_hints_hash = from->cop_hints_hash;
+    if (cop->cop_hints_hash) {
+	HINTS_REFCNT_LOCK;
+	cop->cop_hints_hash->refcounted_he_refcnt++;
+	HINTS_REFCNT_UNLOCK;
+    }
+    CopLINE_set(cop, CopLINE(from));
+#ifdef USE_ITHREADS
+    CopFILE_set(cop, CopFILE(from));
+#else
+    CopFILEGV_set(cop, CopFILEGV(from));
+#endif
+    CopSTASH_set(cop, CopSTASH(from));
+    return (OP*)cop;
+}
+
+/* Inline a call to a sub whose prototype is all $s and whose body is a
+ * single expression that S_inline_expr can copy.  The call is kept: the
+ * OP_INLINESUB in front of it runs the copy only as long as the glob
+ * still holds the same definition of the sub, which it recognises by the
+ * compile-time sequence number the sub was started at. */
+
+STATIC OP *
+S_inline_sub(pTHX_ OP *o, CV *cv)
+{
+    dVAR;
+    const OP *root = CvROOT(cv);
+    const COP *cop;
+    const OP *expr;
+    const char *p;
+    OP *args;
+    OP *kid;
+    OP *inlined;
+    OP *first;
+    OP *start;
+    LOGOP *logop;
+    I32 nargs = 0;
+
+    PERL_ARGS_ASSERT_INLINE_SUB;
+
+    if (CvISXSUB(cv) || !root || CvLVALUE(cv)
+	|| root->op_type != OP_LEAVESUB)
+	return o;
+    for (p = SvPVX_const(MUTABLE_SV(cv)); *p; p++, nargs++)
+	if (*p != '$')
+	    return o;
+
+    expr = cUNOPx(root)->op_first;
+    if (expr->op_type != OP_LINESEQ)
+	return o;
+    cop = (const COP *)cLISTOPx(expr)->op_first;
+    if (cop->op_type != OP_NEXTSTATE)
+	return o;
+    expr = cop->op_sibling;
+    if (!expr || expr->op_sibling)
+	return o;
+    if (expr->op_type == OP_RETURN) {
+	expr = cLISTOPx(expr)->op_first->op_sibling;
+	if (!expr || expr->op_sibling)
+	    return o;
+    }
+
+    /* The copy runs under the pragmata of the caller */
+    if (((CopHINTS_get(cop) ^ PL_hints) & INLINE_HINTS)
+	|| ((CopHINTS_get(cop) | PL_hints) & HINT_ARYBASE))
+	return o;
+    if (cop->cop_warnings != PL_compiling.cop_warnings
+	&& (specialWARN(cop->cop_warnings)
+	    || specialWARN(PL_compiling.cop_warnings)
+	    || *cop->cop_warnings != *PL_compiling.cop_warnings
+	    || memNE(cop->cop_warnings + 1, PL_compiling.cop_warnings + 1,
+		     *cop->cop_warnings)))
+	return o;
+
+    args = cUNOPo->op_first;
+    if (!args->op_sibling)
+	args = cUNOPx(args)->op_first;
+    args = args->op_sibling;		/* skip the pushmark */
+    for (kid = args; kid->op_sibling; kid = kid->op_sibling) {
+	if (kid->op_type == OP_PADSV
+	    ? (kid->op_private & OPpLVAL_INTRO)
+	    : kid->op_type != OP_CONST)
+	    return o;
+    }
+    if (cUNOPx(kid)->op_first->op_type != OP_GV)
+	return o;
+
+    if (!(inlined = inline_expr(expr, cv, args, nargs, FALSE)))
+	return o;
+
+    /* Run the copy in a block of its own, under a copy of the sub's
+     * statement; leaving the block restores the caller's */
+    inlined = newLISTOP(OP_LINESEQ, 0, inline_cop(cop), inlined);
+    inlined->op_flags |= OPf_PARENS;
+    inlined = scope(inlined);
+    inlined->op_flags |= OPf_WANT_SCALAR;
+    cLISTOPx(inlined)->op_first->op_flags |= OPf_WANT_SCALAR;
+
+    first = newSVOP(OP_CONST, 0, newSVuv(CvOUTSIDE_SEQ(cv)));
+
+    NewOp(1101, logop, 1, LOGOP);
+    logop->op_type = OP_INLINESUB;
+    logop->op_ppaddr = PL_ppaddr[OP_INLINESUB];
+    logop->op_first = first;
+    logop->op_flags = OPf_KIDS;
+    logop->op_private = 1;
+    logop->op_other = LINKLIST(inlined);
+    logop->op_next = LINKLIST(o);
+
+    CHECKOP(OP_INLINESUB, logop);
+
+    start = LINKLIST(first);
+    first->op_next = (OP*)logop;
+
+    first->op_sibling = inlined;
+    inlined->op_sibling = o;
+    kid = newUNOP(OP_NULL, 0, (OP*)logop);
+
+    inlined->op_next = o->op_next = kid;
+
+    kid->op_next = start;
+    return kid;
+}
+
 OP *
 Perl_ck_subr(pTHX_ OP *o)
 {
@@ -8270,6 +8620,9 @@ Perl_ck_subr(pTHX_ OP *o)
 	o=newSVOP(OP_CONST, 0, newSViv(0));
 	op_getmad(oldo,o,'O');
     }
+    else if (proto && !PL_madskills
+	     && !(o->op_private & (OPpENTERSUB_AMPER|OPpENTERSUB_DB)))
+	return inline_sub(o, cv);
     return o;
 }
 
@@ -8476,6 +8829,62 @@ S_is_inplace_av(pTHX_ OP *o, OP *oright) {
     return oleft;
 }
 
+/* Checks if o, a pushmark, starts a C<my ($a, $b, ...) = @_> in void
+ * context, which the aassign can do on its own.  Returns the aassign if
+ * so, or NULL otherwise. */
+
+STATIC OP *
+S_is_args_aassign(pTHX_ OP *o) {
+    OP *o2 = o;
+    OP *gvop;
+    OP *lmark;
+
+    PERL_ARGS_ASSERT_IS_ARGS_AASSIGN;
+
+    /* the RHS is just @_ */
+    gvop = o2 = o2->op_next;
+    if (!o2 || o2->op_type != OP_GV || cGVOPx_gv(o2) != PL_defgv)
+	return NULL;
+    o2 = o2->op_next;
+    if (!o2 || o2->op_type != OP_RV2AV || cUNOPx(o2)->op_first != gvop
+	|| (o2->op_flags & OPf_REF) || (o2->op_private & OPpLVAL_INTRO))
+	return NULL;
+    do
+	o2 = o2->op_next;
+    while (o2 && o2->op_type == OP_NULL);
+
+    /* the LHS introduces only lexical scalars */
+    if (!o2 || o2->op_type != OP_PUSHMARK)
+	return NULL;
+    lmark = o2;
+    o2 = o2->op_next;
+    if (!o2 || o2->op_type != OP_PADSV)
+	return NULL;
+    while (o2 && o2->op_type == OP_PADSV) {
+	if ((o2->op_private & (OPpLVAL_INTRO|OPpPAD_STATE|OPpDEREF))
+	    != OPpLVAL_INTRO)
+	    return NULL;
+	o2 = o2->op_next;
+    }
+    while (o2 && o2->op_type == OP_NULL)
+	o2 = o2->op_next;
+    if (!o2 || o2->op_type != OP_AASSIGN
+	|| (o2->op_flags & OPf_WANT) != OPf_WANT_VOID
+	|| (o2->op_private & OPpASSIGN_COMMON))
+	return NULL;
+
+    /* and those are the ops we passed on the way */
+    if (cLISTOPx(cBINOPx(o2)->op_first)->op_first != o
+	|| o->op_sibling->op_sibling
+	|| cLISTOPx(cBINOPx(o2)->op_last)->op_first != lmark)
+	return NULL;
+    for (o = lmark->op_sibling; o; o = o->op_sibling)
+	if (o->op_type != OP_PADSV)
+	    return NULL;
+
+    return o2;
+}
+
 /* A peephole optimizer.  We visit the ops in the order they're to execute.
  * See the comments at the top of this file for more details about when
  * peep() is called */
@@ -8729,6 +9138,7 @@ Perl_peep(pTHX_ register OP *o)
 	case OP_COND_EXPR:
 	case OP_RANGE:
 	case OP_ONCE:
+	case OP_INLINESUB:
 	    while (cLOGOP->op_other->op_type == OP_NULL)
 		cLOGOP->op_other = cLOGOP->op_other->op_next;
 	    peep(cLOGOP->op_other); /* Recursive calls are not replaced by fptr calls */
@@ -9072,6 +9482,20 @@ Perl_peep(pTHX_ register OP *o)
 	    break;
 	}
 
+	case OP_PUSHMARK: {
+	    OP *aassign;
+
+	    /* my (...) = @_: have the aassign find the arguments and the
+	       lexicals itself */
+	    if (oldop && (aassign = is_args_aassign(o))) {
+		o = aassign;
+		o->op_opt = 1;
+		o->op_private |= OPpASSIGN_ARGS;
+		oldop->op_next = o;
+	    }
+	    break;
+	}
+
 	case OP_SASSIGN: {
 	    OP *rv2gv;
 	    UNOP *refgen, *rv2cv;
@@ -162,8 +162,12 @@ Deprecated.  Use C<GIMME_V> instead.
 /* Private for OP_LEAVE, OP_LEAVESUB, OP_LEAVESUBLV and OP_LEAVEWRITE */
 #define OPpREFCOUNTED		64	/* op_targ carries a refcount */
 
+/* Private for OP_RETURN and OP_LEAVESUB */
+#define OPpTAILCALL		32	/* A call returned from may reuse the frame */
+
 /* Private for OP_AASSIGN */
 #define OPpASSIGN_COMMON	64	/* Left & right have syms in common. */
+#define OPpASSIGN_ARGS		4	/* my (...) = @_, done by the aassign */
 
 /* Private for OP_SASSIGN */
 #define OPpASSIGN_BACKWARDS	64	/* Left & right switched. */
@@ -259,6 +263,7 @@ Deprecated.  Use C<GIMME_V> instead.
 #define OPpSORT_DESCEND		16	/* Descending sort */
 #define OPpSORT_QSORT		32	/* Use quicksort (not mergesort) */
 #define OPpSORT_STABLE		64	/* Use a stable algorithm */
+#define OPpSORT_PARALLEL	128	/* May sort on several threads */
 
 /* Private for OP_REVERSE */
 #define OPpREVERSE_INPLACE	8	/* reverse in-place (@a = reverse @a) */
@@ -282,6 +287,9 @@ Deprecated.  Use C<GIMME_V> instead.
     
 /* Private for OP_ENTEREVAL */
 #define OPpEVAL_HAS_HH		2	/* Does it have a copy of %^H */
+
+/* Private for OP_INLINESUB */
+#define OPpINLINE_CALL		2	/* Result may be modified: always call */
     
 struct op {
     BASEOP
@@ -398,6 +398,7 @@ EXTCONST char* const PL_op_name[] = {
 	"syscall",
 	"lock",
 	"once",
+	"inlinesub",
 	"custom",
 };
 #endif
@@ -771,6 +772,7 @@ EXTCONST char* const PL_op_desc[] = {
 	"syscall",
 	"lock",
 	"once",
+	"inlined subroutine call",
 	"unknown custom operator",
 };
 #endif
@@ -1158,6 +1160,7 @@ EXT Perl_ppaddr_t PL_ppaddr[] /* or perlvars.h */
 	MEMBER_TO_FPTR(Perl_pp_syscall),
 	MEMBER_TO_FPTR(Perl_pp_lock),
 	MEMBER_TO_FPTR(Perl_pp_once),
+	MEMBER_TO_FPTR(Perl_pp_inlinesub),
 	MEMBER_TO_FPTR(Perl_unimplemented_op),	/* Perl_pp_custom */
 }
 #endif
@@ -1542,6 +1545,7 @@ EXT Perl_check_t PL_check[] /* or perlvars.h */
 	MEMBER_TO_FPTR(Perl_ck_fun),	/* syscall */
 	MEMBER_TO_FPTR(Perl_ck_rfun),	/* lock */
 	MEMBER_TO_FPTR(Perl_ck_null),	/* once */
+	MEMBER_TO_FPTR(Perl_ck_null),	/* inlinesub */
 	MEMBER_TO_FPTR(Perl_ck_null),	/* custom */
 }
 #endif
@@ -1920,6 +1924,7 @@ EXTCONST U32 PL_opargs[] = {
 	0x0004281d,	/* syscall */
 	0x0000f604,	/* lock */
 	0x00000600,	/* once */
+	0x00000600,	/* inlinesub */
 	0x00000000,	/* custom */
 };
 #endif
@@ -1116,4 +1116,8 @@ lock		lock			ck_rfun		s%	R
 
 once		once			ck_null		|	
 
+# For inlined subroutine calls
+
+inlinesub	inlined subroutine call	ck_null		|	
+
 custom		unknown custom operator		ck_null		0
@@ -1071,6 +1071,9 @@ perl_destruct(pTHXx)
 
     /* Now absolutely destruct everything, somehow or other, loops or no. */
 
+    /* Frozen data can't be freed until it is made ordinary again */
+    sv_clean_frozen();
+
     /* the 2 is for PL_fdpid and PL_strtab */
     while (sv_clean_all() > 2)
 	;
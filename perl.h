@@ -3447,18 +3447,14 @@ struct scan_data_t;		/* Used in S_* functions in regcomp.c */
 struct regnode_charclass_class;	/* Used in S_* functions in regcomp.c */
 
 struct ptr_tbl_ent {
-    struct ptr_tbl_ent*		next;
-    const void*			oldval;
+    const void*			oldval;		/* NULL if the slot is free */
     void*			newval;
 };
 
 struct ptr_tbl {
-    struct ptr_tbl_ent**	tbl_ary;
+    struct ptr_tbl_ent*		tbl_ary;	/* open addressed */
     UV				tbl_max;
     UV				tbl_items;
-    struct ptr_tbl_arena	*tbl_arena;
-    struct ptr_tbl_ent		*tbl_arena_next;
-    struct ptr_tbl_ent		*tbl_arena_end;
 };
 
 #if defined(iAPX286) || defined(M_I286) || defined(I80286)
@@ -4793,7 +4789,8 @@ enum {		/* pass one of these to get_vtbl */
 #define HINT_SORT_SORT_BITS	0x000000FF /* allow 256 different ones */
 #define HINT_SORT_QUICKSORT	0x00000001
 #define HINT_SORT_MERGESORT	0x00000002
-#define HINT_SORT_STABLE	0x00000100 /* sort styles (currently one) */
+#define HINT_SORT_STABLE	0x00000100 /* sort styles */
+#define HINT_SORT_PARALLEL	0x00000200
 
 /* Various states of the input record separator SV (rs) */
 #define RsSNARF(sv)   (! SvOK(sv))
@@ -5402,6 +5399,32 @@ MGVTBL_SET(
     0
 );
 
+#ifdef USE_ITHREADS
+MGVTBL_SET(
+    PL_vtbl_methcache,
+    0,
+    0,
+    0,
+    0,
+    MEMBER_TO_FPTR(Perl_magic_freemethcache),
+    0,
+    MEMBER_TO_FPTR(Perl_magic_dupmethcache),
+    0
+);
+#else
+MGVTBL_SET(
+    PL_vtbl_methcache,
+    0,
+    0,
+    0,
+    0,
+    MEMBER_TO_FPTR(Perl_magic_freemethcache),
+    0,
+    0,
+    0
+);
+#endif
+
 MGVTBL_SET(
     PL_vtbl_utf8,
     0,
@@ -324,6 +324,8 @@ END_EXTERN_C
 #define PL_formfeed		(*Perl_Iformfeed_ptr(aTHX))
 #undef  PL_formtarget
 #define PL_formtarget		(*Perl_Iformtarget_ptr(aTHX))
+#undef  PL_frozen_iters
+#define PL_frozen_iters		(*Perl_Ifrozen_iters_ptr(aTHX))
 #undef  PL_generation
 #define PL_generation		(*Perl_Igeneration_ptr(aTHX))
 #undef  PL_gensym
@@ -65,6 +65,20 @@
 
 #include "XSUB.h"
 
+#if defined(HAS_WRITEV) && defined(I_SYSUIO)
+#  include <sys/uio.h>
+#  define PERLIO_HAS_WRITEV
+#endif
+
+/* Most chunks handed to a single Writev call */
+#define PERLIO_IOV_MAX 16
+
+#if defined(__linux__) && !defined(PERL_MICRO)
+#  include <sys/sendfile.h>
+#  include <sys/syscall.h>
+#  define PERLIO_HAS_SENDFILE
+#endif
+
 #ifdef __Lynx__
 /* Missing proto on LynxOS */
 int mkstemp(char*);
@@ -1128,6 +1142,7 @@ PERLIO_FUNCS_DECL(PerlIO_remove) = {
     NULL,                       /* get_ptr */
     NULL,                       /* get_cnt */
     NULL,                       /* set_ptrcnt */
+    NULL,                       /* writev */
 };
 
 PerlIO_list_t *
@@ -1642,6 +1657,14 @@ Perl_PerlIO_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
      Perl_PerlIO_or_fail(f, Write, -1, (aTHX_ f, vbuf, count));
 }
 
+SSize_t
+Perl_PerlIO_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt)
+{
+     PERL_ARGS_ASSERT_PERLIO_WRITEV;
+
+     Perl_PerlIO_or_Base(f, Writev, writev, -1, (aTHX_ f, iov, iovcnt));
+}
+
 int
 Perl_PerlIO_seek(pTHX_ PerlIO *f, Off_t offset, int whence)
 {
@@ -1898,6 +1921,7 @@ PERLIO_FUNCS_DECL(PerlIO_utf8) = {
     NULL,                       /* get_ptr */
     NULL,                       /* get_cnt */
     NULL,                       /* set_ptrcnt */
+    NULL,                       /* writev */
 };
 
 PERLIO_FUNCS_DECL(PerlIO_byte) = {
@@ -1929,6 +1953,7 @@ PERLIO_FUNCS_DECL(PerlIO_byte) = {
     NULL,                       /* get_ptr */
     NULL,                       /* get_cnt */
     NULL,                       /* set_ptrcnt */
+    NULL,                       /* writev */
 };
 
 PerlIO *
@@ -1974,6 +1999,7 @@ PERLIO_FUNCS_DECL(PerlIO_raw) = {
     NULL,                       /* get_ptr */
     NULL,                       /* get_cnt */
     NULL,                       /* set_ptrcnt */
+    NULL,                       /* writev */
 };
 /*--------------------------------------------------------------------------------------*/
 /*--------------------------------------------------------------------------------------*/
@@ -2100,6 +2126,29 @@ PerlIOBase_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
     return PerlIOBuf_unread(aTHX_ f, vbuf, count);
 }
 
+/*
+ * Gather write for layers without a Writev method: write the chunks one
+ * after the other, stopping at the first one that doesn't go out in full.
+ */
+SSize_t
+PerlIOBase_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt)
+{
+    SSize_t written = 0;
+    int i;
+    for (i = 0; i < iovcnt; i++) {
+	SSize_t count;
+	if (!iov[i].len)
+	    continue;
+	count = PerlIO_write(f, iov[i].base, iov[i].len);
+	if (count < 0)
+	    return written ? written : count;
+	written += count;
+	if ((Size_t)count < iov[i].len)
+	    break;
+    }
+    return written;
+}
+
 SSize_t
 PerlIOBase_read(pTHX_ PerlIO *f, void *vbuf, Size_t count)
 {
@@ -2709,6 +2758,43 @@ PerlIOUnix_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
     /*NOTREACHED*/
 }
 
+SSize_t
+PerlIOUnix_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt)
+{
+#ifdef PERLIO_HAS_WRITEV
+    dVAR;
+    const int fd = PerlIOSelf(f, PerlIOUnix)->fd;
+    struct iovec vec[PERLIO_IOV_MAX];
+    int i;
+#ifdef PERLIO_STD_SPECIAL
+    if (fd == 1 || fd == 2)
+	return PerlIOBase_writev(aTHX_ f, iov, iovcnt);
+#endif
+    /* Like write() we may do less than asked; the caller comes back */
+    if (iovcnt > PERLIO_IOV_MAX)
+	iovcnt = PERLIO_IOV_MAX;
+    for (i = 0; i < iovcnt; i++) {
+	vec[i].iov_base = (char *) iov[i].base;
+	vec[i].iov_len = iov[i].len;
+    }
+    while (1) {
+	const SSize_t len = writev(fd, vec, iovcnt);
+	if (len >= 0 || errno != EINTR) {
+	    if (len < 0) {
+		if (errno != EAGAIN) {
+		    PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+		}
+	    }
+	    return len;
+	}
+	PERL_ASYNC_CHECK();
+    }
+    /*NOTREACHED*/
+#else
+    return PerlIOBase_writev(aTHX_ f, iov, iovcnt);
+#endif
+}
+
 Off_t
 PerlIOUnix_tell(pTHX_ PerlIO *f)
 {
@@ -2776,6 +2862,7 @@ PERLIO_FUNCS_DECL(PerlIO_unix) = {
     NULL,                       /* get_ptr */
     NULL,                       /* get_cnt */
     NULL,                       /* set_ptrcnt */
+    PerlIOUnix_writev,
 };
 
 /*--------------------------------------------------------------------------------------*/
@@ -3581,6 +3668,7 @@ PERLIO_FUNCS_DECL(PerlIO_stdio) = {
     NULL,
     NULL,
 #endif /* USE_STDIO_PTR */
+    NULL,                       /* writev */
 };
 
 /* Note that calls to PerlIO_exportFILE() are reversed using
@@ -3780,7 +3868,8 @@ PerlIOBuf_flush(pTHX_ PerlIO *f)
 	    if (count > 0) {
 		p += count;
 	    }
-	    else if (count < 0 || PerlIO_error(n)) {
+	    else {
+		/* Nothing written is a failure too, or we would spin */
 		PerlIOBase(f)->flags |= PERLIO_F_ERROR;
 		code = -1;
 		break;
@@ -4009,6 +4098,91 @@ PerlIOBuf_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
     return written;
 }
 
+/*
+ * Gather write.  What fits in the buffer is copied there as usual; anything
+ * bigger goes straight to the next layer together with whatever is already
+ * buffered, so large strings are never copied through the buffer.
+ */
+SSize_t
+PerlIOBuf_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt)
+{
+    PerlIOBuf * const b = PerlIOSelf(f, PerlIOBuf);
+    PerlIO *n = PerlIONext(f);
+    PerlIO_iovec vec[PERLIO_IOV_MAX];
+    Size_t total = 0;
+    SSize_t written = 0;
+    int i;
+    if (!b->buf)
+	PerlIO_get_base(f);
+    if (!(PerlIOBase(f)->flags & PERLIO_F_CANWRITE))
+	return 0;
+    if (PerlIOBase(f)->flags & PERLIO_F_RDBUF) {
+	if (PerlIO_flush(f) != 0) {
+	    return 0;
+	}
+    }
+    for (i = 0; i < iovcnt; i++)
+	total += iov[i].len;
+    if (total < b->bufsiz - (b->ptr - b->buf) || !PerlIOValid(n)) {
+	for (i = 0; i < iovcnt; i++) {
+	    if (iov[i].len) {
+		const SSize_t count = PerlIOBuf_write(aTHX_ f, iov[i].base,
+						      iov[i].len);
+		if (count <= 0)
+		    break;
+		written += count;
+		if ((Size_t)count < iov[i].len)
+		    break;
+	    }
+	}
+	return written;
+    }
+    while (iovcnt > 0) {
+	/* Slot 0 carries whatever is still sitting in the buffer */
+	PerlIO_iovec *v = vec;
+	int nvec = 0;
+	const bool buffered = (PerlIOBase(f)->flags & PERLIO_F_WRBUF)
+	    && b->ptr > b->buf;
+	if (buffered) {
+	    vec[0].base = b->buf;
+	    vec[0].len = b->ptr - b->buf;
+	    nvec++;
+	}
+	for (; nvec < PERLIO_IOV_MAX && iovcnt > 0; iov++, iovcnt--) {
+	    if (iov->len)
+		vec[nvec++] = *iov;
+	}
+	while (nvec > 0) {
+	    SSize_t count = PerlIO_writev(n, v, nvec);
+	    if (count > 0) {
+		b->posn += count;
+		while (count > 0) {
+		    const Size_t take = ((Size_t)count < v->len)
+			? (Size_t)count : v->len;
+		    if (!(buffered && v == vec))
+			written += take;
+		    v->base = (const STDCHAR *)v->base + take;
+		    v->len -= take;
+		    count -= take;
+		    if (!v->len) {
+			v++;
+			nvec--;
+		    }
+		}
+	    }
+	    else {
+		/* Nothing written is a failure too, or we would spin */
+		PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+		iovcnt = 0;
+		break;
+	    }
+	}
+	b->ptr = b->end = b->buf;
+	PerlIOBase(f)->flags &= ~PERLIO_F_WRBUF;
+    }
+    return written;
+}
+
 IV
 PerlIOBuf_seek(pTHX_ PerlIO *f, Off_t offset, int whence)
 {
@@ -4180,6 +4354,7 @@ PERLIO_FUNCS_DECL(PerlIO_perlio) = {
     PerlIOBuf_get_ptr,
     PerlIOBuf_get_cnt,
     PerlIOBuf_set_ptrcnt,
+    PerlIOBuf_writev,
 };
 
 /*--------------------------------------------------------------------------------------*/
@@ -4303,6 +4478,7 @@ PERLIO_FUNCS_DECL(PerlIO_pending) = {
     PerlIOBuf_get_ptr,
     PerlIOBuf_get_cnt,
     PerlIOPending_set_ptrcnt,
+    NULL,                       /* writev */
 };
 
 
@@ -4660,6 +4836,7 @@ PERLIO_FUNCS_DECL(PerlIO_crlf) = {
     PerlIOBuf_get_ptr,
     PerlIOCrlf_get_cnt,
     PerlIOCrlf_set_ptrcnt,
+    NULL,                       /* writev */
 };
 
 #ifdef HAS_MMAP
@@ -4949,10 +5126,244 @@ PERLIO_FUNCS_DECL(PerlIO_mmap) = {
     PerlIOBuf_get_ptr,
     PerlIOBuf_get_cnt,
     PerlIOBuf_set_ptrcnt,
+    NULL,                       /* writev */
 };
 
 #endif                          /* HAS_MMAP */
 
+/*--------------------------------------------------------------------------------------*/
+/*
+ * Copying between handles
+ */
+
+/* Largest single request made of the kernel or of the layers */
+#define PERLIO_COPY_CHUNK 0x1000000
+
+/* The file descriptor under f if every layer in between just passes bytes
+ * through, else -1 */
+STATIC int
+S_perlio_raw_fd(pTHX_ PerlIO *f)
+{
+    while (PerlIOValid(f)) {
+	const PerlIO_funcs * const tab = PerlIOBase(f)->tab;
+	if (PerlIOBase(f)->flags & PERLIO_F_CRLF)
+	    return -1;
+	if (tab == PERLIO_FUNCS_CAST(&PerlIO_unix))
+	    return PerlIOSelf(f, PerlIOUnix)->fd;
+	if (tab != PERLIO_FUNCS_CAST(&PerlIO_perlio))
+	    return -1;
+	f = PerlIONext(f);
+    }
+    return -1;
+}
+
+/* Tell the buffer layers of f that the kernel moved the file offset under
+ * them by count bytes */
+STATIC void
+S_perlio_moved(pTHX_ PerlIO *f, Off_t count)
+{
+    while (PerlIOValid(f)) {
+	if (PerlIOBase(f)->tab == PERLIO_FUNCS_CAST(&PerlIO_perlio))
+	    PerlIOSelf(f, PerlIOBuf)->posn += count;
+	f = PerlIONext(f);
+    }
+}
+
+/* Write all of buf to o.  A buffering layer takes the data even when
+ * flushing its buffer fails, and the failure is flagged on whichever
+ * layer the flush was writing to, so look at every layer's error flag
+ * too. */
+STATIC bool
+S_perlio_write_all(pTHX_ PerlIO *o, const STDCHAR *buf, SSize_t count)
+{
+    while (count > 0) {
+	const SSize_t done = PerlIO_write(o, buf, count);
+	PerlIO *l;
+	if (done <= 0)
+	    return FALSE;
+	for (l = o; PerlIOValid(l); l = PerlIONext(l)) {
+	    if (PerlIOBase(l)->flags & PERLIO_F_ERROR)
+		return FALSE;
+	}
+	buf += done;
+	count -= done;
+    }
+    return TRUE;
+}
+
+/*
+ * Copy count bytes, or everything up to end of file if count is negative,
+ * from f to o.  Anything already buffered in f goes first.  When both
+ * handles are plain byte streams straight down to a file descriptor the
+ * data is then moved inside the kernel, by copy_file_range(), sendfile()
+ * or splice() - whichever the kernel accepts for this pair of files -
+ * and otherwise it is read and written through the layers.
+ *
+ * Returns the number of bytes copied, or -1 if anything went wrong, even
+ * after some of the data has been copied.
+ */
+Off_t
+Perl_PerlIO_copy(pTHX_ PerlIO *f, PerlIO *o, Off_t count)
+{
+    Off_t copied = 0;
+    bool ok = TRUE;
+
+    if (!PerlIOValid(f) || !PerlIOValid(o)) {
+	SETERRNO(EBADF, SS_IVCHAN);
+	return -1;
+    }
+
+    /* Whatever has been read ahead into the buffer goes first */
+    if (PerlIO_has_cntptr(f)) {
+	while (count && ok) {
+	    SSize_t avail = PerlIO_get_cnt(f);
+	    STDCHAR *ptr;
+	    if (avail <= 0)
+		break;
+	    if (count > 0 && avail > count)
+		avail = (SSize_t)count;
+	    ptr = PerlIO_get_ptr(f);
+	    ok = S_perlio_write_all(aTHX_ o, ptr, avail);
+	    PerlIO_set_ptrcnt(f, ptr + avail, PerlIO_get_cnt(f) - avail);
+	    copied += avail;
+	    if (count > 0)
+		count -= avail;
+	}
+    }
+
+#ifdef PERLIO_HAS_SENDFILE
+    if (count && ok) {
+	const int fdin = S_perlio_raw_fd(aTHX_ f);
+	const int fdout = S_perlio_raw_fd(aTHX_ o);
+	/* 0: copy_file_range, 1: sendfile, 2: splice, 3: give up */
+	int how = 0;
+	if (fdin >= 0 && fdout >= 0
+	    && PerlIO_flush(f) == 0 && PerlIO_flush(o) == 0)
+	{
+	    Off_t moved = 0;
+	    while (count && how < 3) {
+		const size_t chunk = (count < 0 || count > PERLIO_COPY_CHUNK)
+		    ? PERLIO_COPY_CHUNK : (size_t)count;
+		SSize_t done;
+		switch (how) {
+		case 0:
+#ifdef SYS_copy_file_range
+		    done = syscall(SYS_copy_file_range, fdin, NULL, fdout, NULL,
+				   chunk, 0);
+		    /* some pseudo file systems claim to be empty here */
+		    if (done == 0 && !moved) {
+			how++;
+			continue;
+		    }
+		    break;
+#else
+		    how++;
+		    /* FALLTHROUGH */
+#endif
+		case 1:
+		    done = sendfile(fdout, fdin, NULL, chunk);
+		    break;
+		default:
+#ifdef SYS_splice
+		    done = syscall(SYS_splice, fdin, NULL, fdout, NULL, chunk, 0);
+#else
+		    done = -1;
+		    errno = ENOSYS;
+#endif
+		    break;
+		}
+		if (done < 0) {
+		    if (errno == EINTR) {
+			PERL_ASYNC_CHECK();
+			continue;
+		    }
+		    /* The kernel can't do it for these files: try the next
+		     * method, as long as nothing has been moved yet */
+		    if (!moved && (errno == EINVAL || errno == ENOSYS
+				   || errno == EXDEV || errno == EBADF
+#ifdef EOPNOTSUPP
+				   || errno == EOPNOTSUPP
+#endif
+				   ))
+		    {
+			how++;
+			continue;
+		    }
+		    ok = FALSE;
+		    break;
+		}
+		if (done == 0)
+		    break;
+		moved += done;
+		if (count > 0)
+		    count -= done;
+	    }
+	    if (moved) {
+		S_perlio_moved(aTHX_ f, moved);
+		S_perlio_moved(aTHX_ o, moved);
+		copied += moved;
+	    }
+	    /* Unless every method was declined we are done one way or
+	     * another: the count is met, the input ran dry, or it failed */
+	    if (how < 3)
+		count = 0;
+	}
+    }
+#endif
+
+    /* Through the layers */
+    if (count && ok) {
+	if (PerlIO_has_cntptr(f)) {
+	    /* Straight from f's buffer */
+	    while (count && ok) {
+		SSize_t avail = PerlIO_get_cnt(f);
+		STDCHAR *ptr;
+		if (avail <= 0) {
+		    if (PerlIO_fill(f) != 0) {
+			ok = !PerlIO_error(f);
+			break;
+		    }
+		    continue;
+		}
+		if (count > 0 && avail > count)
+		    avail = (SSize_t)count;
+		ptr = PerlIO_get_ptr(f);
+		ok = S_perlio_write_all(aTHX_ o, ptr, avail);
+		PerlIO_set_ptrcnt(f, ptr + avail, PerlIO_get_cnt(f) - avail);
+		copied += avail;
+		if (count > 0)
+		    count -= avail;
+	    }
+	}
+	else {
+	    STDCHAR buf[8192];
+	    while (count && ok) {
+		const SSize_t want = (count < 0 || count > (Off_t)sizeof(buf))
+		    ? (SSize_t)sizeof(buf) : (SSize_t)count;
+		const SSize_t got = PerlIO_read(f, buf, want);
+		if (got <= 0) {
+		    ok = got == 0 && !PerlIO_error(f);
+		    break;
+		}
+		ok = S_perlio_write_all(aTHX_ o, buf, got);
+		copied += got;
+		if (count > 0)
+		    count -= got;
+	    }
+	}
+    }
+
+    if (!ok) {
+	/* Part of the data may have gone, but the copy as a whole failed.
+	 * A failed read has flagged f already; flag o for anything else,
+	 * so that a later close of o reports it too. */
+	if (!PerlIO_error(f))
+	    PerlIOBase(o)->flags |= PERLIO_F_ERROR;
+	return -1;
+    }
+    return copied;
+}
+
 PerlIO *
 Perl_PerlIO_stdin(pTHX)
 {
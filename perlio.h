@@ -102,6 +102,12 @@ typedef PerlIOl *PerlIO;
 #define PerlIO PerlIO
 #define PERLIO_LAYERS 1
 
+/* One chunk of a gather write - see PerlIO_writev() */
+typedef struct {
+    const void *base;
+    Size_t len;
+} PerlIO_iovec;
+
 /* Making the big PerlIO_funcs vtables const is good (enables placing
  * them in the const section which is good for speed, security, and
  * embeddability) but this cannot be done by default because of
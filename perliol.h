@@ -49,6 +49,8 @@ struct _PerlIO_funcs {
     STDCHAR *(*Get_ptr) (pTHX_ PerlIO *f);
      SSize_t(*Get_cnt) (pTHX_ PerlIO *f);
     void (*Set_ptrcnt) (pTHX_ PerlIO *f, STDCHAR * ptr, SSize_t cnt);
+    /* Gather write - kept last so older tables still initialise */
+     SSize_t(*Writev) (pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt);
 };
 
 /*--------------------------------------------------------------------------------------*/
@@ -190,6 +192,7 @@ PERL_EXPORT_C IV        PerlIOBase_pushed(pTHX_ PerlIO *f, const char *mode, SV
 PERL_EXPORT_C SSize_t   PerlIOBase_read(pTHX_ PerlIO *f, void *vbuf, Size_t count);
 PERL_EXPORT_C void      PerlIOBase_setlinebuf(pTHX_ PerlIO *f);
 PERL_EXPORT_C SSize_t   PerlIOBase_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
+PERL_EXPORT_C SSize_t   PerlIOBase_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt);
 
 /* Buf */
 PERL_EXPORT_C Size_t    PerlIOBuf_bufsiz(pTHX_ PerlIO *f);
@@ -209,6 +212,7 @@ PERL_EXPORT_C void      PerlIOBuf_set_ptrcnt(pTHX_ PerlIO *f, STDCHAR * ptr, SSi
 PERL_EXPORT_C Off_t     PerlIOBuf_tell(pTHX_ PerlIO *f);
 PERL_EXPORT_C SSize_t   PerlIOBuf_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
 PERL_EXPORT_C SSize_t   PerlIOBuf_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
+PERL_EXPORT_C SSize_t   PerlIOBuf_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt);
 
 /* Crlf */
 PERL_EXPORT_C IV        PerlIOCrlf_binmode(pTHX_ PerlIO *f);
@@ -280,6 +284,7 @@ PERL_EXPORT_C void      PerlIOUnix_refcnt_inc(int fd);
 PERL_EXPORT_C IV        PerlIOUnix_seek(pTHX_ PerlIO *f, Off_t offset, int whence);
 PERL_EXPORT_C Off_t     PerlIOUnix_tell(pTHX_ PerlIO *f);
 PERL_EXPORT_C SSize_t   PerlIOUnix_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count);
+PERL_EXPORT_C SSize_t   PerlIOUnix_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt);
 
 /* Utf8 */
 PERL_EXPORT_C IV        PerlIOUtf8_pushed(pTHX_ PerlIO *f, const char *mode, SV *arg, PerlIO_funcs *tab);
@@ -848,7 +848,7 @@ PP(pp_undef)
             /* undef *Pkg::meth_name ... */
             else if(GvCVu((const GV *)sv) && (stash = GvSTASH((const GV *)sv))
 		    && HvNAME_get(stash))
-                mro_method_changed_in(stash);
+                gv_method_changed(MUTABLE_GV(sv));
 
 	    gp_free(MUTABLE_GV(sv));
 	    Newxz(gp, 1, GP);
@@ -5343,6 +5343,8 @@ PP(pp_push)
     }
     else {
 	PL_delaymagic = DM_DELAY;
+	/* Make room for all the new elements at once */
+	av_extend(ary, AvFILLp(ary) + (SP - MARK));
 	for (++MARK; MARK <= SP; MARK++) {
 	    SV * const sv = newSV(0);
 	    if (*MARK)
@@ -2439,6 +2439,189 @@ S_dofindlabel(pTHX_ OP *o, const char *label, OP **opstack, OP **oplimit)
     return 0;
 }
 
+/* The body of goto &sub, shared with the tail calls made by pp_entersub:
+ * replace the innermost sub frame by a call to cv with the frame's @_. */
+
+OP *
+Perl_goto_sub(pTHX_ CV *cv)
+{
+    dVAR; dSP;
+    I32 cxix;
+    register PERL_CONTEXT *cx;
+    SV** mark;
+    I32 items = 0;
+    I32 oldsave;
+    bool reified = 0;
+
+    PERL_ARGS_ASSERT_GOTO_SUB;
+
+  retry:
+    if (!CvROOT(cv) && !CvXSUB(cv)) {
+	const GV * const gv = CvGV(cv);
+	if (gv) {
+	    GV *autogv;
+	    SV *tmpstr;
+	    /* autoloaded stub? */
+	    if (cv != GvCV(gv) && (cv = GvCV(gv)))
+		goto retry;
+	    autogv = gv_autoload4(GvSTASH(gv), GvNAME(gv),
+				  GvNAMELEN(gv), FALSE);
+	    if (autogv && (cv = GvCV(autogv)))
+		goto retry;
+	    tmpstr = sv_newmortal();
+	    gv_efullname3(tmpstr, gv, NULL);
+	    DIE(aTHX_ "Goto undefined subroutine &%"SVf"", SVfARG(tmpstr));
+	}
+	DIE(aTHX_ "Goto undefined subroutine");
+    }
+
+    /* First do some returnish stuff. */
+    SvREFCNT_inc_simple_void(cv); /* avoid premature free during unwind */
+    FREETMPS;
+    cxix = dopoptosub(cxstack_ix);
+    if (cxix < 0)
+	DIE(aTHX_ "Can't goto subroutine outside a subroutine");
+    if (cxix < cxstack_ix)
+	dounwind(cxix);
+    TOPBLOCK(cx);
+    SPAGAIN;
+    /* ban goto in eval: see <20050521150056.GC20213@iabyn.com> */
+    if (CxTYPE(cx) == CXt_EVAL) {
+	if (CxREALEVAL(cx))
+	    DIE(aTHX_ "Can't goto subroutine from an eval-string");
+	else
+	    DIE(aTHX_ "Can't goto subroutine from an eval-block");
+    }
+    else if (CxMULTICALL(cx))
+	DIE(aTHX_ "Can't goto subroutine from a sort sub (or similar callback)");
+    if (CxTYPE(cx) == CXt_SUB && CxHASARGS(cx)) {
+	/* put @_ back onto stack */
+	AV* av = cx->blk_sub.argarray;
+
+	items = AvFILLp(av) + 1;
+	EXTEND(SP, items+1); /* @_ could have been extended. */
+	Copy(AvARRAY(av), SP + 1, items, SV*);
+	SvREFCNT_dec(GvAV(PL_defgv));
+	GvAV(PL_defgv) = cx->blk_sub.savearray;
+	CLEAR_ARGARRAY(av);
+	/* abandon @_ if it got reified */
+	if (AvREAL(av)) {
+	    reified = 1;
+	    SvREFCNT_dec(av);
+	    av = newAV();
+	    av_extend(av, items-1);
+	    AvREIFY_only(av);
+	    PAD_SVl(0) = MUTABLE_SV(cx->blk_sub.argarray = av);
+	}
+    }
+    else if (CvISXSUB(cv)) {	/* put GvAV(defgv) back onto stack */
+	AV* const av = GvAV(PL_defgv);
+	items = AvFILLp(av) + 1;
+	EXTEND(SP, items+1); /* @_ could have been extended. */
+	Copy(AvARRAY(av), SP + 1, items, SV*);
+    }
+    mark = SP;
+    SP += items;
+    if (CxTYPE(cx) == CXt_SUB &&
+	!(CvDEPTH(cx->blk_sub.cv) = cx->blk_sub.olddepth))
+	SvREFCNT_dec(cx->blk_sub.cv);
+    oldsave = PL_scopestack[PL_scopestack_ix - 1];
+    LEAVE_SCOPE(oldsave);
+
+    /* Now do some callish stuff. */
+    SAVETMPS;
+    SAVEFREESV(cv); /* later, undo the 'avoid premature free' hack */
+    if (CvISXSUB(cv)) {
+	OP* const retop = cx->blk_sub.retop;
+	SV **newsp;
+	I32 gimme;
+	if (reified) {
+	    I32 index;
+	    for (index=0; index<items; index++)
+		sv_2mortal(SP[-index]);
+	}
+
+	/* XS subs don't have a CxSUB, so pop it */
+	POPBLOCK(cx, PL_curpm);
+	/* Push a mark for the start of arglist */
+	PUSHMARK(mark);
+	PUTBACK;
+	(void)(*CvXSUB(cv))(aTHX_ cv);
+	LEAVE;
+	return retop;
+    }
+    else {
+	AV* const padlist = CvPADLIST(cv);
+	if (CxTYPE(cx) == CXt_EVAL) {
+	    PL_in_eval = CxOLD_IN_EVAL(cx);
+	    PL_eval_root = cx->blk_eval.old_eval_root;
+	    cx->cx_type = CXt_SUB;
+	}
+	cx->blk_sub.cv = cv;
+	cx->blk_sub.olddepth = CvDEPTH(cv);
+
+	CvDEPTH(cv)++;
+	if (CvDEPTH(cv) < 2)
+	    SvREFCNT_inc_simple_void_NN(cv);
+	else {
+	    if (CvDEPTH(cv) == PERL_SUB_DEPTH_WARN && ckWARN(WARN_RECURSION))
+		sub_crush_depth(cv);
+	    pad_push(padlist, CvDEPTH(cv));
+	}
+	SAVECOMPPAD();
+	PAD_SET_CUR_NOSAVE(padlist, CvDEPTH(cv));
+	if (CxHASARGS(cx))
+	{
+	    AV *const av = MUTABLE_AV(PAD_SVl(0));
+
+	    cx->blk_sub.savearray = GvAV(PL_defgv);
+	    GvAV(PL_defgv) = MUTABLE_AV(SvREFCNT_inc_simple(av));
+	    CX_CURPAD_SAVE(cx->blk_sub);
+	    cx->blk_sub.argarray = av;
+
+	    if (items >= AvMAX(av) + 1) {
+		SV **ary = AvALLOC(av);
+		if (AvARRAY(av) != ary) {
+		    AvMAX(av) += AvARRAY(av) - AvALLOC(av);
+		    AvARRAY(av) = ary;
+		}
+		if (items >= AvMAX(av) + 1) {
+		    AvMAX(av) = items - 1;
+		    Renew(ary,items+1,SV*);
+		    AvALLOC(av) = ary;
+		    AvARRAY(av) = ary;
+		}
+	    }
+	    ++mark;
+	    Copy(mark,AvARRAY(av),items,SV*);
+	    AvFILLp(av) = items - 1;
+	    assert(!AvREAL(av));
+	    if (reified) {
+		/* transfer 'ownership' of refcnts to new @_ */
+		AvREAL_on(av);
+		AvREIFY_off(av);
+	    }
+	    while (items--) {
+		if (*mark)
+		    SvTEMP_off(*mark);
+		mark++;
+	    }
+	}
+	if (PERLDB_SUB) {	/* Checking curstash breaks DProf. */
+	    Perl_get_db_sub(aTHX_ NULL, cv);
+	    if (PERLDB_GOTO) {
+		CV * const gotocv = get_cvs("DB::goto", 0);
+		if (gotocv) {
+		    PUSHMARK( PL_stack_sp );
+		    call_sv(MUTABLE_SV(gotocv), G_SCALAR | G_NODEBUG);
+		    PL_stack_sp--;
+		}
+	    }
+	}
+	RETURNOP(CvSTART(cv));
+    }
+}
+
 PP(pp_goto)
 {
     dVAR; dSP;
@@ -2456,179 +2639,8 @@ PP(pp_goto)
 
 	/* This egregious kludge implements goto &subroutine */
 	if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVCV) {
-	    I32 cxix;
-	    register PERL_CONTEXT *cx;
-	    CV *cv = MUTABLE_CV(SvRV(sv));
-	    SV** mark;
-	    I32 items = 0;
-	    I32 oldsave;
-	    bool reified = 0;
-
-	retry:
-	    if (!CvROOT(cv) && !CvXSUB(cv)) {
-		const GV * const gv = CvGV(cv);
-		if (gv) {
-		    GV *autogv;
-		    SV *tmpstr;
-		    /* autoloaded stub? */
-		    if (cv != GvCV(gv) && (cv = GvCV(gv)))
-			goto retry;
-		    autogv = gv_autoload4(GvSTASH(gv), GvNAME(gv),
-					  GvNAMELEN(gv), FALSE);
-		    if (autogv && (cv = GvCV(autogv)))
-			goto retry;
-		    tmpstr = sv_newmortal();
-		    gv_efullname3(tmpstr, gv, NULL);
-		    DIE(aTHX_ "Goto undefined subroutine &%"SVf"", SVfARG(tmpstr));
-		}
-		DIE(aTHX_ "Goto undefined subroutine");
-	    }
-
-	    /* First do some returnish stuff. */
-	    SvREFCNT_inc_simple_void(cv); /* avoid premature free during unwind */
-	    FREETMPS;
-	    cxix = dopoptosub(cxstack_ix);
-	    if (cxix < 0)
-		DIE(aTHX_ "Can't goto subroutine outside a subroutine");
-	    if (cxix < cxstack_ix)
-		dounwind(cxix);
-	    TOPBLOCK(cx);
-	    SPAGAIN;
-	    /* ban goto in eval: see <20050521150056.GC20213@iabyn.com> */
-	    if (CxTYPE(cx) == CXt_EVAL) {
-		if (CxREALEVAL(cx))
-		    DIE(aTHX_ "Can't goto subroutine from an eval-string");
-		else
-		    DIE(aTHX_ "Can't goto subroutine from an eval-block");
-	    }
-	    else if (CxMULTICALL(cx))
-		DIE(aTHX_ "Can't goto subroutine from a sort sub (or similar callback)");
-	    if (CxTYPE(cx) == CXt_SUB && CxHASARGS(cx)) {
-		/* put @_ back onto stack */
-		AV* av = cx->blk_sub.argarray;
-
-		items = AvFILLp(av) + 1;
-		EXTEND(SP, items+1); /* @_ could have been extended. */
-		Copy(AvARRAY(av), SP + 1, items, SV*);
-		SvREFCNT_dec(GvAV(PL_defgv));
-		GvAV(PL_defgv) = cx->blk_sub.savearray;
-		CLEAR_ARGARRAY(av);
-		/* abandon @_ if it got reified */
-		if (AvREAL(av)) {
-		    reified = 1;
-		    SvREFCNT_dec(av);
-		    av = newAV();
-		    av_extend(av, items-1);
-		    AvREIFY_only(av);
-		    PAD_SVl(0) = MUTABLE_SV(cx->blk_sub.argarray = av);
-		}
-	    }
-	    else if (CvISXSUB(cv)) {	/* put GvAV(defgv) back onto stack */
-		AV* const av = GvAV(PL_defgv);
-		items = AvFILLp(av) + 1;
-		EXTEND(SP, items+1); /* @_ could have been extended. */
-		Copy(AvARRAY(av), SP + 1, items, SV*);
-	    }
-	    mark = SP;
-	    SP += items;
-	    if (CxTYPE(cx) == CXt_SUB &&
-		!(CvDEPTH(cx->blk_sub.cv) = cx->blk_sub.olddepth))
-		SvREFCNT_dec(cx->blk_sub.cv);
-	    oldsave = PL_scopestack[PL_scopestack_ix - 1];
-	    LEAVE_SCOPE(oldsave);
-
-	    /* Now do some callish stuff. */
-	    SAVETMPS;
-	    SAVEFREESV(cv); /* later, undo the 'avoid premature free' hack */
-	    if (CvISXSUB(cv)) {
-		OP* const retop = cx->blk_sub.retop;
-		SV **newsp;
-		I32 gimme;
-		if (reified) {
-		    I32 index;
-		    for (index=0; index<items; index++)
-			sv_2mortal(SP[-index]);
-		}
-
-		/* XS subs don't have a CxSUB, so pop it */
-		POPBLOCK(cx, PL_curpm);
-		/* Push a mark for the start of arglist */
-		PUSHMARK(mark);
-		PUTBACK;
-		(void)(*CvXSUB(cv))(aTHX_ cv);
-		LEAVE;
-		return retop;
-	    }
-	    else {
-		AV* const padlist = CvPADLIST(cv);
-		if (CxTYPE(cx) == CXt_EVAL) {
-		    PL_in_eval = CxOLD_IN_EVAL(cx);
-		    PL_eval_root = cx->blk_eval.old_eval_root;
-		    cx->cx_type = CXt_SUB;
-		}
-		cx->blk_sub.cv = cv;
-		cx->blk_sub.olddepth = CvDEPTH(cv);
-
-		CvDEPTH(cv)++;
-		if (CvDEPTH(cv) < 2)
-		    SvREFCNT_inc_simple_void_NN(cv);
-		else {
-		    if (CvDEPTH(cv) == PERL_SUB_DEPTH_WARN && ckWARN(WARN_RECURSION))
-			sub_crush_depth(cv);
-		    pad_push(padlist, CvDEPTH(cv));
-		}
-		SAVECOMPPAD();
-		PAD_SET_CUR_NOSAVE(padlist, CvDEPTH(cv));
-		if (CxHASARGS(cx))
-		{
-		    AV *const av = MUTABLE_AV(PAD_SVl(0));
-
-		    cx->blk_sub.savearray = GvAV(PL_defgv);
-		    GvAV(PL_defgv) = MUTABLE_AV(SvREFCNT_inc_simple(av));
-		    CX_CURPAD_SAVE(cx->blk_sub);
-		    cx->blk_sub.argarray = av;
-
-		    if (items >= AvMAX(av) + 1) {
-			SV **ary = AvALLOC(av);
-			if (AvARRAY(av) != ary) {
-			    AvMAX(av) += AvARRAY(av) - AvALLOC(av);
-			    AvARRAY(av) = ary;
-			}
-			if (items >= AvMAX(av) + 1) {
-			    AvMAX(av) = items - 1;
-			    Renew(ary,items+1,SV*);
-			    AvALLOC(av) = ary;
-			    AvARRAY(av) = ary;
-			}
-		    }
-		    ++mark;
-		    Copy(mark,AvARRAY(av),items,SV*);
-		    AvFILLp(av) = items - 1;
-		    assert(!AvREAL(av));
-		    if (reified) {
-			/* transfer 'ownership' of refcnts to new @_ */
-			AvREAL_on(av);
-			AvREIFY_off(av);
-		    }
-		    while (items--) {
-			if (*mark)
-			    SvTEMP_off(*mark);
-			mark++;
-		    }
-		}
-		if (PERLDB_SUB) {	/* Checking curstash breaks DProf. */
-		    Perl_get_db_sub(aTHX_ NULL, cv);
-		    if (PERLDB_GOTO) {
-			CV * const gotocv = get_cvs("DB::goto", 0);
-			if (gotocv) {
-			    PUSHMARK( PL_stack_sp );
-			    call_sv(MUTABLE_SV(gotocv), G_SCALAR | G_NODEBUG);
-			    PL_stack_sp--;
-			}
-		    }
-		}
-		RETURNOP(CvSTART(cv));
-	    }
+	    PUTBACK;
+	    return goto_sub(MUTABLE_CV(SvRV(sv)));
 	}
 	else {
 	    label = SvPV_nolen_const(sv);
@@ -212,6 +212,31 @@ PP(pp_cond_expr)
 	RETURNOP(cLOGOP->op_next);
 }
 
+/* Run the inlined copy of a sub (op_other) rather than the call to it
+ * (op_next) if the sub hasn't been redefined since it was inlined.  The
+ * sequence number the sub was compiled at is on the stack. */
+
+PP(pp_inlinesub)
+{
+    dVAR; dSP;
+    const U32 seq = (U32)SvUVX(POPs);
+
+    if (!(PL_op->op_private & OPpINLINE_CALL)) {
+	const OP *kid =
+	    cUNOPx(cLOGOP->op_first->op_sibling->op_sibling)->op_first;
+	const CV *cv;
+
+	if (!kid->op_sibling)
+	    kid = cUNOPx(kid)->op_first;
+	while (kid->op_sibling)
+	    kid = kid->op_sibling;
+	cv = GvCVu(cGVOPx_gv(cUNOPx(kid)->op_first));
+	if (cv && CvOUTSIDE_SEQ(cv) == seq && !CvISXSUB(cv) && CvROOT(cv))
+	    RETURNOP(cLOGOP->op_other);
+    }
+    RETURNOP(cLOGOP->op_next);
+}
+
 PP(pp_unstack)
 {
     dVAR;
@@ -763,29 +788,8 @@ PP(pp_print)
     }
     else {
 	SV * const ofs = GvSV(PL_ofsgv); /* $, */
-	MARK++;
-	if (ofs && (SvGMAGICAL(ofs) || SvOK(ofs))) {
-	    while (MARK <= SP) {
-		if (!do_print(*MARK, fp))
-		    break;
-		MARK++;
-		if (MARK <= SP) {
-		    /* don't use 'ofs' here - it may be invalidated by magic callbacks */
-		    if (!do_print(GvSV(PL_ofsgv), fp)) {
-			MARK--;
-			break;
-		    }
-		}
-	    }
-	}
-	else {
-	    while (MARK <= SP) {
-		if (!do_print(*MARK, fp))
-		    break;
-		MARK++;
-	    }
-	}
-	if (MARK <= SP)
+	if (!do_printv(MARK + 1, SP, fp,
+		       ofs && (SvGMAGICAL(ofs) || SvOK(ofs))))
 	    goto just_say_no;
 	else {
 	    if (PL_op->op_type == OP_SAY) {
@@ -970,13 +974,52 @@ S_do_oddball(pTHX_ HV *hash, SV **relem, SV **firstrelem)
     }
 }
 
+/* my ($a, $b, ...) = @_ in void context.  The peephole optimiser has
+ * skipped the ops that would put @_ and the lexicals on the stack, so
+ * introduce each lexical here and copy the next argument into it. */
+
+STATIC OP *
+S_aassign_args(pTHX)
+{
+    dVAR; dSP;
+    AV * const av = GvAVn(PL_defgv);
+    const I32 fill = AvFILL(av);
+    const OP *kid = cLISTOPx(cBINOP->op_last)->op_first->op_sibling;
+    SV **args;
+    I32 i;
+
+    if (SvRMAGICAL(av)) {
+	/* fetch all of them first, as pp_rv2av would */
+	EXTEND(SP, fill + 1);
+	args = SP + 1;
+	for (i = 0; i <= fill; i++) {
+	    SV ** const svp = av_fetch(av, i, FALSE);
+	    args[i] = svp
+		? SvGMAGICAL(*svp) ? (mg_get(*svp), *svp) : *svp
+		: &PL_sv_undef;
+	}
+    }
+    else
+	args = AvARRAY(av);
+
+    for (i = 0; kid; kid = kid->op_sibling, i++) {
+	SV * const sv = PAD_SVl(kid->op_targ);
+
+	SAVECLEARSV(PAD_SVl(kid->op_targ));
+	TAINT_NOT;		/* Each item stands on its own, taintwise. */
+	sv_setsv(sv, i <= fill ? args[i] : &PL_sv_undef);
+	SvSETMAGIC(sv);
+    }
+    return NORMAL;
+}
+
 PP(pp_aassign)
 {
     dVAR; dSP;
-    SV **lastlelem = PL_stack_sp;
-    SV **lastrelem = PL_stack_base + POPMARK;
-    SV **firstrelem = PL_stack_base + POPMARK + 1;
-    SV **firstlelem = lastrelem + 1;
+    SV **lastlelem;
+    SV **lastrelem;
+    SV **firstrelem;
+    SV **firstlelem;
 
     register SV **relem;
     register SV **lelem;
@@ -991,6 +1034,14 @@ PP(pp_aassign)
     int duplicates = 0;
     SV **firsthashrelem = NULL;	/* "= 0" keeps gcc 2.95 quiet  */
 
+    if (PL_op->op_private & OPpASSIGN_ARGS)
+	return aassign_args();
+
+    lastlelem = PL_stack_sp;
+    lastrelem = PL_stack_base + POPMARK;
+    firstrelem = PL_stack_base + POPMARK + 1;
+    firstlelem = lastrelem + 1;
+
     PL_delaymagic = DM_DELAY;		/* catch simultaneous items */
     gimme = GIMME_V;
 
@@ -2699,6 +2750,71 @@ PP(pp_leavesublv)
     return cx->blk_sub.retop;
 }
 
+/* Under "use tailcall", a call whose results are all the current sub
+ * returns replaces the sub's frame instead of stacking a new one, as
+ * goto &sub does.  Returns NULL when the call at PL_op is not in such a
+ * tail position. */
+
+STATIC OP *
+S_tail_call(pTHX_ CV *cv)
+{
+    dVAR; dSP;
+    SV **mark = PL_stack_base + TOPMARK;
+    I32 cxix = cxstack_ix;
+    register PERL_CONTEXT *cx;
+    AV *av;
+    AV *oldav;
+    I32 items;
+
+    PERL_ARGS_ASSERT_TAIL_CALL;
+
+    if (PL_op->op_next->op_type == OP_RETURN) {
+	/* nothing else may be on the stack for the return */
+	if (PL_markstack_ptr[-1] != TOPMARK)
+	    return NULL;
+	while (cxix >= 0 && CxTYPE_is_LOOP(&cxstack[cxix]))
+	    cxix--;
+	if (cxix < 0)
+	    return NULL;
+	cx = &cxstack[cxix];
+    }
+    else if (PL_op->op_next->op_type == OP_LEAVESUB) {
+	cx = &cxstack[cxix];
+	if (mark != PL_stack_base + cx->blk_oldsp)
+	    return NULL;
+    }
+    else
+	return NULL;
+
+    if (CxTYPE(cx) != CXt_SUB || !CxHASARGS(cx) || CxMULTICALL(cx)
+	|| CvLVALUE(cx->blk_sub.cv) || GIMME_V != cx->blk_gimme
+	|| PL_curpad[0] != MUTABLE_SV(cx->blk_sub.argarray))
+	return NULL;
+
+    /* The frame's pad is about to be unwound and reused: hold on to the
+     * arguments, copying the pad temporaries, in a reified @_ for
+     * goto_sub to pass on. */
+    items = SP - mark;
+    av = newAV();
+    if (items) {
+	SV **ary;
+	av_extend(av, items - 1);
+	ary = AvARRAY(av);
+	while (mark < SP) {
+	    SV * const sv = *++mark;
+	    *ary++ = !sv ? NULL
+		   : SvPADTMP(sv) ? newSVsv(sv) : SvREFCNT_inc_simple_NN(sv);
+	}
+	AvFILLp(av) = items - 1;
+    }
+    PL_stack_sp = PL_stack_base + POPMARK;
+
+    oldav = cx->blk_sub.argarray;
+    PL_curpad[0] = MUTABLE_SV(cx->blk_sub.argarray = av);
+    SvREFCNT_dec(oldav);
+    return goto_sub(cv);
+}
+
 PP(pp_entersub)
 {
     dVAR; dSP; dPOPss;
@@ -2760,6 +2876,17 @@ PP(pp_entersub)
 	break;
     }
 
+    if (hasargs && PL_op->op_next
+	&& (PL_op->op_next->op_private & OPpTAILCALL)
+	&& !(PL_op->op_private & OPpENTERSUB_DB)
+	&& !CvISXSUB(cv) && CvROOT(cv))
+    {
+	OP *nextop;
+	PUTBACK;
+	if ((nextop = tail_call(cv)))
+	    return nextop;
+    }
+
     ENTER;
     SAVETMPS;
 
@@ -3072,6 +3199,14 @@ PP(pp_method_named)
     RETURN;
 }
 
+/* Where a method_named op keeps its name, as cSVOP_sv finds it */
+#ifdef USE_ITHREADS
+#  define METHOD_NAME_SVp \
+	(cSVOP->op_sv ? &cSVOP->op_sv : &PAD_SVl(PL_op->op_targ))
+#else
+#  define METHOD_NAME_SVp (&cSVOP->op_sv)
+#endif
+
 STATIC SV *
 S_method_common(pTHX_ SV* meth, U32* hashp)
 {
@@ -3157,13 +3292,24 @@ S_method_common(pTHX_ SV* meth, U32* hashp)
 
     /* shortcut for simple names */
     if (hashp) {
-	const HE* const he = hv_fetch_ent(stash, meth, 0, *hashp);
+	const HE* he;
+	CV* cv;
+
+	/* this op has called the method on this class before */
+	if (stash && (cv = method_cache_fetch(meth, stash)))
+	    return MUTABLE_SV(cv);
+
+	he = hv_fetch_ent(stash, meth, 0, *hashp);
 	if (he) {
 	    gv = MUTABLE_GV(HeVAL(he));
 	    if (isGV(gv) && GvCV(gv) &&
 		(!GvCVGEN(gv) || GvCVGEN(gv)
                   == (PL_sub_generation + HvMROMETA(stash)->cache_gen)))
+	    {
+		if (stash)
+		    method_cache_store(METHOD_NAME_SVp, stash, gv);
 		return MUTABLE_SV(GvCV(gv));
+	    }
 	}
     }
 
@@ -3173,6 +3319,15 @@ S_method_common(pTHX_ SV* meth, U32* hashp)
 
     assert(gv);
 
+    /* If the lookup cached what it found in the stash, so can we.  An
+       AUTOLOAD has to be called the slow way, as that is what sets
+       $AUTOLOAD, and it is never cached there. */
+    if (hashp && stash && isGV(gv) && GvCV(gv)) {
+	const HE * const he = hv_fetch_ent(stash, meth, 0, *hashp);
+	if (he && isGV(HeVAL(he)) && GvCV(HeVAL(he)) == GvCV(gv))
+	    method_cache_store(METHOD_NAME_SVp, stash, MUTABLE_GV(HeVAL(he)));
+    }
+
     return isGV(gv) ? MUTABLE_SV(GvCV(gv)) : MUTABLE_SV(gv);
 }
 
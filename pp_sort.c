@@ -348,8 +348,12 @@ cmp_desc(pTHX_ gptr const a, gptr const b)
     return -PL_sort_RealCmp(aTHX_ a, b);
 }
 
+/* scratch, if not NULL, is an auxiliary array of at least nmemb elements
+ * supplied by the caller, in which case mergesortsv allocates nothing. */
+
 STATIC void
-S_mergesortsv(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+S_mergesortsv(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags,
+	      gptr *scratch)
 {
     dVAR;
     IV i, run, offset;
@@ -371,7 +375,8 @@ S_mergesortsv(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
 	cmp = cmp_desc;
     }
 
-    if (nmemb <= SMALLSORT) aux = small;	/* use stack for aux array */
+    if (scratch) aux = scratch;			/* caller provided aux array */
+    else if (nmemb <= SMALLSORT) aux = small;	/* use stack for aux array */
     else { Newx(aux,nmemb,gptr); }		/* allocate auxilliary array */
     level = 0;
     stackp = stack;
@@ -555,7 +560,7 @@ S_mergesortsv(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
 	}
     }
 done:
-    if (aux != small) Safefree(aux);	/* free iff allocated */
+    if (aux != small && aux != scratch) Safefree(aux); /* free iff allocated */
     if (flags) {
 	 PL_sort_RealCmp = savecmp;	/* Restore current comparison routine, if any */
     }
@@ -1463,13 +1468,334 @@ Perl_sortsv_flags(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
     if (flags & SORTf_QSORT)
 	S_qsortsv(aTHX_ array, nmemb, cmp, flags);
     else
-	S_mergesortsv(aTHX_ array, nmemb, cmp, flags);
+	S_mergesortsv(aTHX_ array, nmemb, cmp, flags, NULL);
+}
+
+#if defined(USE_ITHREADS) && defined(I_PTHREAD) && !defined(OLD_PTHREADS_API) \
+    && !defined(WIN32) && !defined(NETWARE) && !defined(OS2) \
+    && !defined(I_MACH_CTHREADS)
+#  define PERL_SORT_PARALLEL
+#endif
+
+#ifdef PERL_SORT_PARALLEL
+
+/*
+ * Parallel mergesort, used by pp_sort under "use sort 'parallel'".
+ *
+ * The list is cut into one chunk per thread, the chunks are sorted
+ * concurrently with mergesortsv, and then merged pairwise, again
+ * concurrently, until one run remains.  Every merge takes from the left
+ * run on ties, so the result is stable, just like mergesortsv.
+ *
+ * The worker threads have no interpreter of their own.  They may only
+ * run comparisons that read a value already cached in the SV, so pp_sort
+ * comes here only for the built-in comparators and only when every
+ * element is a plain, non-magical SV of the right type.  All memory is
+ * allocated before the threads start, because Newx and friends need the
+ * current interpreter.
+ */
+
+#define PSORT_MIN_ELEMS		(1 << 17)	/* shorter lists: one thread */
+#define PSORT_MIN_CHUNK		(1 << 15)	/* smallest per-thread share */
+#define PSORT_MAX_THREADS	8
+
+typedef struct {
+    PerlInterpreter *interp;
+    SVCOMPARE_t cmp;
+    gptr *list1;		/* chunk to sort, or first run to merge */
+    size_t n1;
+    gptr *list2;		/* second run to merge; NULL when sorting */
+    size_t n2;
+    gptr *out;			/* sort: scratch; merge: destination */
+} psort_job;
+
+static I32
+S_sv_ncmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    return -S_sv_ncmp(aTHX_ a, b);
+}
+
+static I32
+S_sv_i_ncmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    return -S_sv_i_ncmp(aTHX_ a, b);
+}
+
+static I32
+S_sv_cmp_desc(pTHX_ SV *const a, SV *const b)
+{
+    return -sv_cmp_static(aTHX_ a, b);
+}
+
+static void *
+S_psort_work(void *arg)
+{
+    psort_job * const job = (psort_job *)arg;
+    dTHXa(job->interp);
+
+    if (!job->list2) {
+	S_mergesortsv(aTHX_ job->list1, job->n1, job->cmp, 0, job->out);
+    }
+    else {
+	const SVCOMPARE_t cmp = job->cmp;
+	register gptr *l1 = job->list1, *l2 = job->list2, *o = job->out;
+	gptr * const e1 = l1 + job->n1;
+	gptr * const e2 = l2 + job->n2;
+
+	while (l1 < e1 && l2 < e2) {
+	    if (cmp(aTHX_ (SV *)*l2, (SV *)*l1) < 0)
+		*o++ = *l2++;
+	    else
+		*o++ = *l1++;
+	}
+	while (l1 < e1)
+	    *o++ = *l1++;
+	while (l2 < e2)
+	    *o++ = *l2++;
+    }
+    return NULL;
+}
+
+/* Run njobs jobs, the first on the calling thread.  A job whose thread
+ * couldn't be started is run here instead. */
+
+static void
+S_psort_run(psort_job *jobs, int njobs)
+{
+    pthread_t tid[PSORT_MAX_THREADS];
+    bool started[PSORT_MAX_THREADS];
+    int i;
+#ifdef HAS_SIGPROCMASK
+    sigset_t all, old;
+
+    /* Signals are for the interpreter thread; workers inherit this mask */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+#endif
+    for (i = 1; i < njobs; i++)
+	started[i] = pthread_create(&tid[i], NULL, S_psort_work, &jobs[i]) == 0;
+#ifdef HAS_SIGPROCMASK
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+#endif
+
+    S_psort_work(&jobs[0]);
+    for (i = 1; i < njobs; i++) {
+	if (started[i])
+	    pthread_join(tid[i], NULL);
+	else
+	    S_psort_work(&jobs[i]);
+    }
+}
+
+/* Returns FALSE, having done nothing, if the list is too short or cmp
+ * isn't one the worker threads can call. */
+
+STATIC bool
+S_psortsv(pTHX_ gptr *base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+{
+    psort_job jobs[PSORT_MAX_THREADS];
+    size_t bounds[PSORT_MAX_THREADS + 1];
+    gptr *aux, *src, *dst;
+    long ncpu = 0;
+    int nruns, i;
+
+    if (nmemb < PSORT_MIN_ELEMS)
+	return FALSE;
+
+    if (cmp == S_sv_ncmp)
+	cmp = (flags & SORTf_DESC) ? S_sv_ncmp_desc : S_sv_ncmp;
+    else if (cmp == S_sv_i_ncmp)
+	cmp = (flags & SORTf_DESC) ? S_sv_i_ncmp_desc : S_sv_i_ncmp;
+    else if (cmp == (SVCOMPARE_t)sv_cmp_static)
+	cmp = (flags & SORTf_DESC) ? S_sv_cmp_desc : (SVCOMPARE_t)sv_cmp_static;
+    else
+	return FALSE;
+
+#ifdef _SC_NPROCESSORS_ONLN
+    ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    nruns = ncpu > PSORT_MAX_THREADS ? PSORT_MAX_THREADS : (int)ncpu;
+    if ((size_t)nruns > nmemb / PSORT_MIN_CHUNK)
+	nruns = (int)(nmemb / PSORT_MIN_CHUNK);
+    if (nruns < 2)
+	return FALSE;
+
+    Newx(aux, nmemb, gptr);
+    for (i = 0; i <= nruns; i++)
+	bounds[i] = nmemb / nruns * i + (i == nruns ? nmemb % nruns : 0);
+
+    for (i = 0; i < nruns; i++) {
+	jobs[i].interp = aTHX;
+	jobs[i].cmp = cmp;
+	jobs[i].list1 = base + bounds[i];
+	jobs[i].n1 = bounds[i+1] - bounds[i];
+	jobs[i].list2 = NULL;
+	jobs[i].n2 = 0;
+	jobs[i].out = aux + bounds[i];
+    }
+    S_psort_run(jobs, nruns);
+
+    /* Merge neighbouring runs, flipping between base and aux */
+    src = base;
+    dst = aux;
+    while (nruns > 1) {
+	const int npairs = nruns / 2;
+	for (i = 0; i < npairs; i++) {
+	    const size_t lo = bounds[2*i], mid = bounds[2*i+1];
+	    const size_t hi = bounds[2*i+2];
+	    jobs[i].list1 = src + lo;
+	    jobs[i].n1 = mid - lo;
+	    jobs[i].list2 = src + mid;
+	    jobs[i].n2 = hi - mid;
+	    jobs[i].out = dst + lo;
+	}
+	if (nruns & 1)
+	    Copy(src + bounds[nruns-1], dst + bounds[nruns-1],
+		 bounds[nruns] - bounds[nruns-1], gptr);
+	S_psort_run(jobs, npairs);
+
+	for (i = 0; i <= npairs; i++)
+	    bounds[i] = bounds[2*i < nruns ? 2*i : nruns];
+	nruns = (nruns + 1) / 2;
+	bounds[nruns] = nmemb;
+	src = dst;
+	dst = (src == base) ? aux : base;
+    }
+    if (src != base)
+	Copy(src, base, nmemb, gptr);
+    Safefree(aux);
+    return TRUE;
 }
 
+#endif /* PERL_SORT_PARALLEL */
+
 #define SvNSIOK(sv) ((SvFLAGS(sv) & SVf_NOK) || ((SvFLAGS(sv) & (SVf_IOK|SVf_IVisUV)) == SVf_IOK))
 #define SvSIOK(sv) ((SvFLAGS(sv) & (SVf_IOK|SVf_IVisUV)) == SVf_IOK)
 #define SvNSIV(sv) ( SvNOK(sv) ? SvNVX(sv) : ( SvSIOK(sv) ? SvIVX(sv) : sv_2nv(sv) ) )
 
+#if defined(HAS_QUAD) && NVSIZE == 8 && !defined(__VAX)
+#  define PERL_SORT_RADIX
+#endif
+
+#ifdef PERL_SORT_RADIX
+
+/*
+ * Radix sort for the built-in comparators.
+ *
+ * Each element is reduced to a 64-bit key whose unsigned order is the
+ * order the comparator would give: the sign-flipped IV, the IEEE bits of
+ * the NV rearranged so negative numbers come first, or the first eight
+ * bytes of the string.  The (key, SV) pairs are then sorted with a stable
+ * LSD radix sort, a byte per pass, skipping any byte that is the same in
+ * every key.  No SV is looked at again until the sorted pointers are
+ * written back.  String keys only hold a prefix, so each run of equal
+ * keys is finished off with mergesortsv.  pp_sort calls this only when
+ * every element is a plain SV with the right value cached already.
+ */
+
+#define RSORT_MIN_ELEMS	512	/* below this mergesort wins */
+
+typedef struct {
+    U64 key;
+    SV *sv;
+} rsort_item;
+
+STATIC bool
+S_radixsortsv(pTHX_ SV **base, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+{
+    const U64 sign = (U64)1 << 63;
+    const U64 flip = (flags & SORTf_DESC) ? ~(U64)0 : 0;
+    size_t count[8][256];
+    rsort_item *items, *tmp, *src, *dst;
+    size_t i;
+    int b;
+
+    if (nmemb < RSORT_MIN_ELEMS || (flags & SORTf_QSORT))
+	return FALSE;
+    if (cmp != S_sv_ncmp && cmp != S_sv_i_ncmp
+	&& cmp != (SVCOMPARE_t)sv_cmp_static)
+	return FALSE;
+
+    Newx(items, nmemb, rsort_item);
+    Zero(count[0], 8 * 256, size_t);
+    for (i = 0; i < nmemb; i++) {
+	SV * const sv = base[i];
+	U64 key;
+
+	if (cmp == S_sv_i_ncmp)
+	    key = (U64)(I64)SvIVX(sv) ^ sign;
+	else if (cmp == S_sv_ncmp) {
+	    NV nv = SvNSIV(sv);
+	    if (nv != nv) {		/* NaN compares equal to everything */
+		Safefree(items);
+		return FALSE;
+	    }
+	    if (nv == 0.0)
+		nv = 0.0;		/* and -0.0 equal to 0.0 */
+	    Copy(&nv, &key, 1, U64);
+	    key = (key & sign) ? ~key : key | sign;
+	}
+	else {
+	    const U8 *pv = (const U8 *)SvPVX_const(sv);
+	    const STRLEN len = SvCUR(sv);
+	    int j;
+	    key = 0;
+	    for (j = 0; j < 8; j++)
+		key = (key << 8) | (j < (int)len ? pv[j] : 0);
+	}
+	key ^= flip;
+	items[i].key = key;
+	items[i].sv = sv;
+	for (b = 0; b < 8; b++)
+	    count[b][(key >> (b * 8)) & 0xFF]++;
+    }
+
+    Newx(tmp, nmemb, rsort_item);
+    src = items;
+    dst = tmp;
+    for (b = 0; b < 8; b++) {
+	const int shift = b * 8;
+	size_t * const c = count[b];
+	size_t pos = 0;
+	int d;
+
+	if (c[(src[0].key >> shift) & 0xFF] == nmemb)
+	    continue;			/* every key has this byte */
+	for (d = 0; d < 256; d++) {
+	    const size_t n = c[d];
+	    c[d] = pos;
+	    pos += n;
+	}
+	for (i = 0; i < nmemb; i++)
+	    dst[c[(src[i].key >> shift) & 0xFF]++] = src[i];
+	{
+	    rsort_item * const t = src;
+	    src = dst;
+	    dst = t;
+	}
+    }
+    for (i = 0; i < nmemb; i++)
+	base[i] = src[i].sv;
+
+    if (cmp == (SVCOMPARE_t)sv_cmp_static) {
+	size_t start = 0;
+	for (i = 1; i <= nmemb; i++) {
+	    if (i == nmemb || src[i].key != src[start].key) {
+		if (i - start > 1)
+		    S_mergesortsv(aTHX_ (gptr *)base + start, i - start, cmp,
+				  flags & SORTf_DESC, NULL);
+		start = i;
+	    }
+	}
+    }
+
+    Safefree(items);
+    Safefree(tmp);
+    return TRUE;
+}
+
+#endif /* PERL_SORT_RADIX */
+
 PP(pp_sort)
 {
     dVAR; dSP; dMARK; dORIGMARK;
@@ -1491,6 +1817,9 @@ PP(pp_sort)
     void (*sortsvp)(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
       = Perl_sortsv_flags;
     I32 all_SIVs = 1;
+    /* Can the comparisons be done without calling back into perl? */
+    bool all_plain = TRUE;
+    U32 utf8_seen = 0;
 
     if ((priv & OPpSORT_DESCEND) != 0)
 	sort_flags |= SORTf_DESC;
@@ -1606,6 +1935,21 @@ PP(pp_sort)
 		}
 		if (SvAMAGIC(*p1))
 		    overloading = 1;
+		if (all_plain) {
+		    if (SvGMAGICAL(*p1))
+			all_plain = FALSE;
+		    else if (priv & OPpSORT_NUMERIC)
+			all_plain = (priv & OPpSORT_INTEGER)
+			    ? SvIOK(*p1) : SvNSIOK(*p1);
+		    else if (!SvPOK(*p1))
+			all_plain = FALSE;
+		    else {
+			/* Mixed UTF-8ness would make sv_cmp allocate */
+			utf8_seen |= SvUTF8(*p1) ? 2 : 1;
+			if (utf8_seen == 3)
+			    all_plain = FALSE;
+		    }
+		}
 	    }
 	    p1++;
 	}
@@ -1688,10 +2032,7 @@ PP(pp_sort)
 	    CATCH_SET(oldcatch);
 	}
 	else {
-	    MEXTEND(SP, 20);	/* Can't afford stack realloc on signal. */
-	    start = sorting_av ? AvARRAY(av) : ORIGMARK+1;
-	    sortsvp(aTHX_ start, max,
-		    (priv & OPpSORT_NUMERIC)
+	    const SVCOMPARE_t cmp = (priv & OPpSORT_NUMERIC)
 		        ? ( ( ( priv & OPpSORT_INTEGER) || all_SIVs)
 			    ? ( overloading ? S_amagic_i_ncmp : S_sv_i_ncmp)
 			    : ( overloading ? S_amagic_ncmp : S_sv_ncmp ) )
@@ -1699,8 +2040,22 @@ PP(pp_sort)
 			    ? ( overloading
 				? (SVCOMPARE_t)S_amagic_cmp_locale
 				: (SVCOMPARE_t)sv_cmp_locale_static)
-			    : ( overloading ? (SVCOMPARE_t)S_amagic_cmp : (SVCOMPARE_t)sv_cmp_static)),
-		    sort_flags);
+			    : ( overloading ? (SVCOMPARE_t)S_amagic_cmp : (SVCOMPARE_t)sv_cmp_static));
+
+	    bool sorted = FALSE;
+
+	    MEXTEND(SP, 20);	/* Can't afford stack realloc on signal. */
+	    start = sorting_av ? AvARRAY(av) : ORIGMARK+1;
+#ifdef PERL_SORT_PARALLEL
+	    if (all_plain && (priv & OPpSORT_PARALLEL))
+		sorted = S_psortsv(aTHX_ start, max, cmp, sort_flags);
+#endif
+#ifdef PERL_SORT_RADIX
+	    if (all_plain && !sorted)
+		sorted = S_radixsortsv(aTHX_ start, max, cmp, sort_flags);
+#endif
+	    if (!sorted)
+		sortsvp(aTHX_ start, max, cmp, sort_flags);
 	}
 	if ((priv & OPpSORT_REVERSE) != 0) {
 	    SV **q = start+max-1;
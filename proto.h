@@ -235,6 +235,11 @@ PERL_CALLCONV SV*	Perl_av_shift(pTHX_ AV *av)
 #define PERL_ARGS_ASSERT_AV_SHIFT	\
 	assert(av)
 
+PERL_CALLCONV void	Perl_av_shrink(pTHX_ AV *av)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_AV_SHRINK	\
+	assert(av)
+
 PERL_CALLCONV SV**	Perl_av_store(pTHX_ AV *av, I32 key, SV *val)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_AV_STORE	\
@@ -694,6 +699,13 @@ PERL_CALLCONV bool	Perl_do_print(pTHX_ SV* sv, PerlIO* fp)
 #define PERL_ARGS_ASSERT_DO_PRINT	\
 	assert(fp)
 
+PERL_CALLCONV bool	Perl_do_printv(pTHX_ SV** mark, SV** sp, PerlIO* fp, bool use_ofs)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_DO_PRINTV	\
+	assert(mark); assert(sp); assert(fp)
+
 PERL_CALLCONV OP*	Perl_do_readline(pTHX)
 			__attribute__warn_unused_result__;
 
@@ -850,6 +862,11 @@ PERL_CALLCONV void	Perl_get_db_sub(pTHX_ SV **svp, CV *cv)
 #define PERL_ARGS_ASSERT_GET_DB_SUB	\
 	assert(cv)
 
+PERL_CALLCONV OP*	Perl_goto_sub(pTHX_ CV *cv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_GOTO_SUB	\
+	assert(cv)
+
 PERL_CALLCONV void	Perl_gp_free(pTHX_ GV* gv);
 PERL_CALLCONV GP*	Perl_gp_ref(pTHX_ GP* gp);
 PERL_CALLCONV GV*	Perl_gv_add_by_type(pTHX_ GV *gv, svtype type);
@@ -923,6 +940,20 @@ PERL_CALLCONV GV*	Perl_gv_fetchmethod_flags(pTHX_ HV* stash, const char* name, U
 #define PERL_ARGS_ASSERT_GV_FETCHMETHOD_FLAGS	\
 	assert(stash); assert(name)
 
+PERL_CALLCONV CV*	Perl_method_cache_fetch(pTHX_ SV* meth, HV* stash)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_METHOD_CACHE_FETCH	\
+	assert(meth); assert(stash)
+
+PERL_CALLCONV void	Perl_method_cache_store(pTHX_ SV** methp, HV* stash, GV* gv)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_METHOD_CACHE_STORE	\
+	assert(methp); assert(stash); assert(gv)
+
 PERL_CALLCONV GV*	Perl_gv_fetchpv(pTHX_ const char *nambeg, I32 add, const svtype sv_type)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_GV_FETCHPV	\
@@ -1533,6 +1564,11 @@ STATIC OP*	S_is_inplace_av(pTHX_ OP* o, OP* oright)
 #define PERL_ARGS_ASSERT_IS_INPLACE_AV	\
 	assert(o)
 
+STATIC OP*	S_is_args_aassign(pTHX_ OP* o)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_IS_ARGS_AASSIGN	\
+	assert(o)
+
 #endif
 PERL_CALLCONV void	Perl_leave_scope(pTHX_ I32 base);
 PERL_CALLCONV void	Perl_lex_end(pTHX);
@@ -1699,6 +1735,20 @@ PERL_CALLCONV int	Perl_magic_freeovrld(pTHX_ SV* sv, MAGIC* mg)
 #define PERL_ARGS_ASSERT_MAGIC_FREEOVRLD	\
 	assert(sv); assert(mg)
 
+PERL_CALLCONV int	Perl_magic_freemethcache(pTHX_ SV* sv, MAGIC* mg)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_MAGIC_FREEMETHCACHE	\
+	assert(sv); assert(mg)
+
+#if defined(USE_ITHREADS)
+PERL_CALLCONV int	Perl_magic_dupmethcache(pTHX_ MAGIC* mg, CLONE_PARAMS* param)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_MAGIC_DUPMETHCACHE	\
+	assert(mg); assert(param)
+
+#endif
 PERL_CALLCONV int	Perl_magic_get(pTHX_ SV* sv, MAGIC* mg)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
@@ -3311,6 +3361,7 @@ PERL_CALLCONV void	Perl_sv_chop(pTHX_ SV *const sv, const char *const ptr)
 
 PERL_CALLCONV I32	Perl_sv_clean_all(pTHX);
 PERL_CALLCONV void	Perl_sv_clean_objs(pTHX);
+PERL_CALLCONV void	Perl_sv_clean_frozen(pTHX);
 PERL_CALLCONV void	Perl_sv_clear(pTHX_ SV *const sv)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_SV_CLEAR	\
@@ -4521,6 +4572,11 @@ STATIC struct xpvhv_aux*	S_hv_auxinit(HV *hv)
 #define PERL_ARGS_ASSERT_HV_AUXINIT	\
 	assert(hv)
 
+STATIC struct xpvhv_aux*	S_hv_iter_aux(pTHX_ HV *hv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_ITER_AUX	\
+	assert(hv)
+
 STATIC SV*	S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, STRLEN klen, int k_flags, I32 d_flags, U32 hash);
 STATIC void	S_clear_placeholders(pTHX_ HV *hv, U32 items)
 			__attribute__nonnull__(pTHX_1);
@@ -4935,6 +4991,35 @@ STATIC OP*	S_too_many_arguments(pTHX_ OP *o, const char* name)
 #define PERL_ARGS_ASSERT_TOO_MANY_ARGUMENTS	\
 	assert(o); assert(name)
 
+STATIC OP*	S_inline_sub(pTHX_ OP *o, CV *cv)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_INLINE_SUB	\
+	assert(o); assert(cv)
+
+STATIC OP*	S_inline_cop(pTHX_ const COP *from)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_INLINE_COP	\
+	assert(from)
+
+STATIC OP*	S_inline_expr(pTHX_ const OP *o, CV *cv, OP *args, I32 nargs, bool deref)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_INLINE_EXPR	\
+	assert(o); assert(cv); assert(args)
+
+STATIC OP*	S_inline_arg(pTHX_ OP *args, I32 nargs, IV ix, bool deref)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_INLINE_ARG	\
+	assert(args)
+
+STATIC bool	S_tailcalls_enabled(pTHX)
+			__attribute__warn_unused_result__;
+
 STATIC bool	S_looks_like_bool(pTHX_ const OP* o)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_LOOKS_LIKE_BOOL	\
@@ -5258,6 +5343,12 @@ STATIC void	S_do_oddball(pTHX_ HV *hash, SV **relem, SV **firstrelem)
 #define PERL_ARGS_ASSERT_DO_ODDBALL	\
 	assert(hash); assert(relem); assert(firstrelem)
 
+STATIC OP*	S_aassign_args(pTHX);
+STATIC OP*	S_tail_call(pTHX_ CV *cv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_TAIL_CALL	\
+	assert(cv)
+
 STATIC SV*	S_method_common(pTHX_ SV* meth, U32* hashp)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(pTHX_1);
@@ -5869,6 +5960,17 @@ STATIC PTR_TBL_ENT_t *	S_ptr_table_find(PTR_TBL_t *const tbl, const void *const
 #define PERL_ARGS_ASSERT_PTR_TABLE_FIND	\
 	assert(tbl)
 
+STATIC SV *	S_sv_freeze_copy(pTHX_ SV *const sv, PTR_TBL_t *const seen)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_SV_FREEZE_COPY	\
+	assert(sv); assert(seen)
+
+STATIC void	S_sv_freeze_free_seen(pTHX_ void *seen)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_SV_FREEZE_FREE_SEEN	\
+	assert(seen)
+
 #endif
 
 #if defined(PERL_IN_TOKE_C) || defined(PERL_DECL_PROT)
@@ -6200,6 +6302,11 @@ PERL_CALLCONV void	Perl_sv_copypv(pTHX_ SV *const dsv, SV *const ssv)
 #define PERL_ARGS_ASSERT_SV_COPYPV	\
 	assert(dsv); assert(ssv)
 
+PERL_CALLCONV SV*	Perl_sv_freeze(pTHX_ SV *const sv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_SV_FREEZE	\
+	assert(sv)
+
 PERL_CALLCONV char*	Perl_my_atof2(pTHX_ const char *s, NV* value)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
@@ -6239,6 +6346,12 @@ PERL_CALLCONV SSize_t	Perl_PerlIO_write(pTHX_ PerlIO *f, const void *vbuf, Size_
 #define PERL_ARGS_ASSERT_PERLIO_WRITE	\
 	assert(vbuf)
 
+PERL_CALLCONV SSize_t	Perl_PerlIO_writev(pTHX_ PerlIO *f, const PerlIO_iovec *iov, int iovcnt)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_PERLIO_WRITEV	\
+	assert(iov)
+
+PERL_CALLCONV Off_t	Perl_PerlIO_copy(pTHX_ PerlIO *f, PerlIO *o, Off_t count);
 PERL_CALLCONV SSize_t	Perl_PerlIO_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
 			__attribute__nonnull__(pTHX_2);
 #define PERL_ARGS_ASSERT_PERLIO_UNREAD	\
@@ -6881,6 +6994,24 @@ PERL_CALLCONV void	Perl_mro_method_changed_in(pTHX_ HV* stash)
 #define PERL_ARGS_ASSERT_MRO_METHOD_CHANGED_IN	\
 	assert(stash)
 
+PERL_CALLCONV void	Perl_gv_method_changed(pTHX_ GV* gv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_GV_METHOD_CHANGED	\
+	assert(gv)
+
+#if defined(PERL_IN_MRO_C) || defined(PERL_DECL_PROT)
+STATIC void	S_mro_method_changed(pTHX_ HV* stash, const GV* gv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_MRO_METHOD_CHANGED	\
+	assert(stash)
+
+STATIC bool	S_mro_overloaded(pTHX_ HV* stash)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_MRO_OVERLOADED	\
+	assert(stash)
+
+#endif
 PERL_CALLCONV void	Perl_boot_core_mro(pTHX);
 PERL_CALLCONV void	Perl_sys_init(int* argc, char*** argv)
 			__attribute__nonnull__(1)
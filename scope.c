@@ -295,7 +295,7 @@ Perl_save_gp(pTHX_ GV *gv, I32 empty)
 	GP *gp = Perl_newGP(aTHX_ gv);
 
 	if (GvCVu(gv))
-            mro_method_changed_in(GvSTASH(gv)); /* taking a method out of circulation ("local")*/
+            gv_method_changed(gv); /* taking a method out of circulation ("local")*/
 	if (GvIOp(gv) && (IoFLAGS(GvIOp(gv)) & IOf_ARGV)) {
 	    gp->gp_io = newIO();
 	    IoFLAGS(gp->gp_io) |= IOf_ARGV|IOf_START;
@@ -861,7 +861,7 @@ Perl_leave_scope(pTHX_ I32 base)
 		SvFAKE_on(gv);
             /* putting a method back into circulation ("local")*/
 	    if (GvCVu(gv) && (hv=GvSTASH(gv)) && HvNAME_get(hv))
-                mro_method_changed_in(hv);
+                gv_method_changed(gv);
 	    SvREFCNT_dec(gv);
 	    break;
 	case SAVEt_FREESV:
@@ -553,6 +553,71 @@ Perl_sv_clean_objs(pTHX)
     PL_in_clean_objs = FALSE;
 }
 
+/* called by sv_clean_frozen() for each read-only SV */
+
+static void
+do_clean_frozen(pTHX_ SV *const sv)
+{
+    dVAR;
+    if (!SvFROZEN(sv))
+	return;
+
+    /* Everything a frozen SV refers to is frozen too, and is released in
+     * the same pass, so drop the links without counting them down */
+    switch (SvTYPE(sv)) {
+    case SVt_PVAV:
+	AvREAL_off(sv);
+	break;
+    case SVt_PVHV:
+	if (HvARRAY(sv)) {
+	    HE ** const array = HvARRAY(sv);
+	    STRLEN i;
+	    for (i = 0; i <= HvMAX(sv); i++) {
+		HE *he;
+		for (he = array[i]; he; he = HeNEXT(he))
+		    HeVAL(he) = NULL;
+	    }
+	}
+	break;
+    default:
+	if (SvROK(sv)) {
+	    SvRV_set(sv, NULL);
+	    SvROK_off(sv);
+	}
+	break;
+    }
+    DEBUG_D((PerlIO_printf(Perl_debug_log, "Thawing frozen SV at 0x%"UVxf"\n", PTR2UV(sv)) ));
+    SvREADONLY_off(sv);
+    SvREFCNT(sv) = 1;
+}
+
+/*
+=for apidoc sv_clean_frozen
+
+Make all the data frozen by C<sv_freeze> in this interpreter ordinary
+again, so that C<sv_clean_all> can free it.  Called during global
+destruction, once no other thread can be using it.
+
+=cut
+*/
+
+void
+Perl_sv_clean_frozen(pTHX)
+{
+    dVAR;
+
+    /* This interpreter's iterators over frozen hashes */
+    if (PL_frozen_iters) {
+	UV i;
+	for (i = 0; i <= PL_frozen_iters->tbl_max; i++)
+	    if (PL_frozen_iters->tbl_ary[i].oldval)
+		Safefree(PL_frozen_iters->tbl_ary[i].newval);
+	ptr_table_free(PL_frozen_iters);
+	PL_frozen_iters = NULL;
+    }
+    visit(do_clean_frozen, SVf_READONLY, SVf_READONLY);
+}
+
 /* called by sv_clean_all() for each live SV */
 
 static void
@@ -3673,7 +3738,7 @@ S_glob_assign_glob(pTHX_ SV *const dstr, SV *const sstr, const int dtype)
 	}
     GvMULTI_on(dstr);
     if(mro_changes == 2) mro_isa_changed_in(GvSTASH(dstr));
-    else if(mro_changes) mro_method_changed_in(GvSTASH(dstr));
+    else if(mro_changes) gv_method_changed(MUTABLE_GV(dstr));
     return;
 }
 
@@ -3772,7 +3837,7 @@ S_glob_assign_ref(pTHX_ SV *const dstr, SV *const sstr)
 	    }
 	    GvCVGEN(dstr) = 0; /* Switch off cacheness. */
 	    GvASSUMECV_on(dstr);
-	    if(GvSTASH(dstr)) mro_method_changed_in(GvSTASH(dstr)); /* sub foo { 1 } sub bar { 2 } *bar = \&foo */
+	    if(GvSTASH(dstr)) gv_method_changed(MUTABLE_GV(dstr)); /* sub foo { 1 } sub bar { 2 } *bar = \&foo */
 	}
 	*location = sref;
 	if (import_flag && !(GvFLAGS(dstr) & import_flag)
@@ -5276,6 +5341,9 @@ push a back-reference to this RV onto the array of backreferences
 associated with that magic. If the RV is magical, set magic will be
 called after the RV is cleared.
 
+References to frozen data (see C<sv_freeze>) are left strong, as that data
+is never freed while the program runs, and can't be given the magic.
+
 =cut
 */
 
@@ -5295,6 +5363,9 @@ Perl_sv_rvweaken(pTHX_ SV *const sv)
 	return sv;
     }
     tsv = SvRV(sv);
+    /* Frozen data is never freed, and must not grow backref magic */
+    if (SvFROZEN(tsv))
+	return sv;
     Perl_sv_add_backref(aTHX_ tsv, sv);
     SvWEAKREF_on(sv);
     SvREFCNT_dec(tsv);
@@ -5802,7 +5873,7 @@ Perl_sv_clear(pTHX_ register SV *const sv)
 	if (isGV_with_GP(sv)) {
             if(GvCVu((const GV *)sv) && (stash = GvSTASH(MUTABLE_GV(sv)))
 	       && HvNAME_get(stash))
-                mro_method_changed_in(stash);
+                gv_method_changed(MUTABLE_GV(sv));
 	    gp_free(MUTABLE_GV(sv));
 	    if (GvNAME_HEK(sv))
 		unshare_hek(GvNAME_HEK(sv));
@@ -8888,7 +8959,7 @@ S_sv_unglob(pTHX_ SV *const sv)
     if (GvGP(sv)) {
         if(GvCVu((const GV *)sv) && (stash = GvSTASH(MUTABLE_GV(sv)))
 	   && HvNAME_get(stash))
-            mro_method_changed_in(stash);
+            gv_method_changed(MUTABLE_GV(sv));
 	gp_free(MUTABLE_GV(sv));
     }
     if (GvSTASH(sv)) {
@@ -10764,10 +10835,14 @@ Perl_mg_dup(pTHX_ MAGIC *mg, CLONE_PARAMS *const param)
 
 #endif /* USE_ITHREADS */
 
-struct ptr_tbl_arena {
-    struct ptr_tbl_arena *next;
-    struct ptr_tbl_ent array[1023/3]; /* as ptr_tbl_ent has 3 pointers.  */
-};
+/* Pointer tables use open addressing with linear probing, and double in
+ * size once half full, so a lookup usually reads a single cache line.
+ * perl_clone maps every SV, HE and GP of the parent through one of these,
+ * so for a big interpreter the table is far larger than the caches.
+ * A free slot has a NULL oldval; a NULL key is stored under the address
+ * of ptr_table_null instead. */
+
+static const char ptr_table_null = 0;
 
 /* create a new pointer-mapping table */
 
@@ -10780,32 +10855,27 @@ Perl_ptr_table_new(pTHX)
     Newx(tbl, 1, PTR_TBL_t);
     tbl->tbl_max	= 511;
     tbl->tbl_items	= 0;
-    tbl->tbl_arena	= NULL;
-    tbl->tbl_arena_next	= NULL;
-    tbl->tbl_arena_end	= NULL;
-    Newxz(tbl->tbl_ary, tbl->tbl_max + 1, PTR_TBL_ENT_t*);
+    Newxz(tbl->tbl_ary, tbl->tbl_max + 1, PTR_TBL_ENT_t);
     return tbl;
 }
 
 #define PTR_TABLE_HASH(ptr) \
   ((PTR2UV(ptr) >> 3) ^ (PTR2UV(ptr) >> (3 + 7)) ^ (PTR2UV(ptr) >> (3 + 17)))
 
-/* map an existing pointer using a table */
+/* find the slot holding a pointer, or the free one it would go in */
 
 STATIC PTR_TBL_ENT_t *
 S_ptr_table_find(PTR_TBL_t *const tbl, const void *const sv)
 {
-    PTR_TBL_ENT_t *tblent;
-    const UV hash = PTR_TABLE_HASH(sv);
+    const void *const key = sv ? sv : (const void *)&ptr_table_null;
+    PTR_TBL_ENT_t *const ary = tbl->tbl_ary;
+    UV i = PTR_TABLE_HASH(key) & tbl->tbl_max;
 
     PERL_ARGS_ASSERT_PTR_TABLE_FIND;
 
-    tblent = tbl->tbl_ary[hash & tbl->tbl_max];
-    for (; tblent; tblent = tblent->next) {
-	if (tblent->oldval == sv)
-	    return tblent;
-    }
-    return NULL;
+    while (ary[i].oldval && ary[i].oldval != key)
+	i = (i + 1) & tbl->tbl_max;
+    return ary + i;
 }
 
 void *
@@ -10816,7 +10886,7 @@ Perl_ptr_table_fetch(pTHX_ PTR_TBL_t *const tbl, const void *const sv)
     PERL_ARGS_ASSERT_PTR_TABLE_FETCH;
     PERL_UNUSED_CONTEXT;
 
-    return tblent ? tblent->newval : NULL;
+    return tblent->oldval ? tblent->newval : NULL;
 }
 
 /* add a new entry to a pointer-mapping table */
@@ -10824,72 +10894,38 @@ Perl_ptr_table_fetch(pTHX_ PTR_TBL_t *const tbl, const void *const sv)
 void
 Perl_ptr_table_store(pTHX_ PTR_TBL_t *const tbl, const void *const oldsv, void *const newsv)
 {
-    PTR_TBL_ENT_t *tblent = ptr_table_find(tbl, oldsv);
+    PTR_TBL_ENT_t *const tblent = ptr_table_find(tbl, oldsv);
 
     PERL_ARGS_ASSERT_PTR_TABLE_STORE;
     PERL_UNUSED_CONTEXT;
 
-    if (tblent) {
-	tblent->newval = newsv;
-    } else {
-	const UV entry = PTR_TABLE_HASH(oldsv) & tbl->tbl_max;
-
-	if (tbl->tbl_arena_next == tbl->tbl_arena_end) {
-	    struct ptr_tbl_arena *new_arena;
-
-	    Newx(new_arena, 1, struct ptr_tbl_arena);
-	    new_arena->next = tbl->tbl_arena;
-	    tbl->tbl_arena = new_arena;
-	    tbl->tbl_arena_next = new_arena->array;
-	    tbl->tbl_arena_end = new_arena->array
-		+ sizeof(new_arena->array) / sizeof(new_arena->array[0]);
-	}
-
-	tblent = tbl->tbl_arena_next++;
-
-	tblent->oldval = oldsv;
-	tblent->newval = newsv;
-	tblent->next = tbl->tbl_ary[entry];
-	tbl->tbl_ary[entry] = tblent;
-	tbl->tbl_items++;
-	if (tblent->next && tbl->tbl_items > tbl->tbl_max)
+    tblent->newval = newsv;
+    if (!tblent->oldval) {
+	tblent->oldval = oldsv ? oldsv : (const void *)&ptr_table_null;
+	if (++tbl->tbl_items > tbl->tbl_max / 2)
 	    ptr_table_split(tbl);
     }
 }
 
-/* double the hash bucket size of an existing ptr table */
+/* double the size of an existing ptr table */
 
 void
 Perl_ptr_table_split(pTHX_ PTR_TBL_t *const tbl)
 {
-    PTR_TBL_ENT_t **ary = tbl->tbl_ary;
+    PTR_TBL_ENT_t *const oldary = tbl->tbl_ary;
     const UV oldsize = tbl->tbl_max + 1;
-    UV newsize = oldsize * 2;
     UV i;
 
     PERL_ARGS_ASSERT_PTR_TABLE_SPLIT;
     PERL_UNUSED_CONTEXT;
 
-    Renew(ary, newsize, PTR_TBL_ENT_t*);
-    Zero(&ary[oldsize], newsize-oldsize, PTR_TBL_ENT_t*);
-    tbl->tbl_max = --newsize;
-    tbl->tbl_ary = ary;
-    for (i=0; i < oldsize; i++, ary++) {
-	PTR_TBL_ENT_t **curentp, **entp, *ent;
-	if (!*ary)
-	    continue;
-	curentp = ary + oldsize;
-	for (entp = ary, ent = *ary; ent; ent = *entp) {
-	    if ((newsize & PTR_TABLE_HASH(ent->oldval)) != i) {
-		*entp = ent->next;
-		ent->next = *curentp;
-		*curentp = ent;
-		continue;
-	    }
-	    else
-		entp = &ent->next;
-	}
+    Newxz(tbl->tbl_ary, oldsize * 2, PTR_TBL_ENT_t);
+    tbl->tbl_max = oldsize * 2 - 1;
+    for (i = 0; i < oldsize; i++) {
+	if (oldary[i].oldval)
+	    *ptr_table_find(tbl, oldary[i].oldval) = oldary[i];
     }
+    Safefree(oldary);
 }
 
 /* remove all the entries from a ptr table */
@@ -10899,21 +10935,8 @@ void
 Perl_ptr_table_clear(pTHX_ PTR_TBL_t *const tbl)
 {
     if (tbl && tbl->tbl_items) {
-	struct ptr_tbl_arena *arena = tbl->tbl_arena;
-
-	Zero(tbl->tbl_ary, tbl->tbl_max + 1, struct ptr_tbl_ent **);
-
-	while (arena) {
-	    struct ptr_tbl_arena *next = arena->next;
-
-	    Safefree(arena);
-	    arena = next;
-	};
-
+	Zero(tbl->tbl_ary, tbl->tbl_max + 1, PTR_TBL_ENT_t);
 	tbl->tbl_items = 0;
-	tbl->tbl_arena = NULL;
-	tbl->tbl_arena_next = NULL;
-	tbl->tbl_arena_end = NULL;
     }
 }
 
@@ -10922,23 +10945,165 @@ Perl_ptr_table_clear(pTHX_ PTR_TBL_t *const tbl)
 void
 Perl_ptr_table_free(pTHX_ PTR_TBL_t *const tbl)
 {
-    struct ptr_tbl_arena *arena;
-
     if (!tbl) {
         return;
     }
+    Safefree(tbl->tbl_ary);
+    Safefree(tbl);
+}
+
+/*
+=for apidoc sv_freeze
+
+Returns a deep copy of C<sv>, a scalar, array or hash, that can never be
+changed, and is only freed by global destruction (see C<sv_clean_frozen>).
+Every part of the copy is read-only, hashes in it are
+restricted (see L<Hash::Util>), and every value is stored both as a string
+and as a number, so that reading it never modifies it.  Threads created
+afterwards share the copy with the thread that made it, rather than cloning
+it.  Each interpreter keeps its own iterators for the hashes in the copy
+(see C<hv_iterinit>), so threads can iterate over them at the same time.
+C<sv_rvweaken> does nothing to references to the copy, which stay strong.
+
+Croaks if the data contains anything other than plain values and
+references to scalars, arrays and hashes, or, on threaded perls, if not
+called by the main interpreter, which must outlive any thread that can see
+the copy.
+
+=cut
+*/
+
+SV *
+Perl_sv_freeze(pTHX_ SV *const sv)
+{
+    PTR_TBL_t *seen;
+    SV *dsv;
+    UV i;
+
+    PERL_ARGS_ASSERT_SV_FREEZE;
 
-    arena = tbl->tbl_arena;
+#ifdef USE_ITHREADS
+    if (PL_curinterp != aTHX)
+	Perl_croak(aTHX_ "Data can only be frozen by the main thread");
+#endif
 
-    while (arena) {
-	struct ptr_tbl_arena *next = arena->next;
+    ENTER;
+    seen = ptr_table_new();
+    SAVEDESTRUCTOR_X(S_sv_freeze_free_seen, seen);
+    /* Caching numeric values isn't an error in the caller's code */
+    SAVECOMPILEWARNINGS();
+    SAVEVPTR(PL_curcop);
+    PL_compiling.cop_warnings = pWARN_NONE;
+    PL_curcop = &PL_compiling;
 
-	Safefree(arena);
-	arena = next;
+    dsv = sv_freeze_copy(sv, seen);
+
+    /* Everything in the copy is in the table, and only there */
+    for (i = 0; i <= seen->tbl_max; i++) {
+	SV * const fsv = MUTABLE_SV(seen->tbl_ary[i].newval);
+	if (seen->tbl_ary[i].oldval && !SvFROZEN(fsv)) {
+	    SvTEMP_off(fsv);
+	    SvREADONLY_on(fsv);
+	    SvREFCNT(fsv) = SV_FROZEN_REFCNT;
+	}
     }
+    LEAVE;
+    return dsv;
+}
 
-    Safefree(tbl->tbl_ary);
-    Safefree(tbl);
+STATIC void
+S_sv_freeze_free_seen(pTHX_ void *seen)
+{
+    PERL_ARGS_ASSERT_SV_FREEZE_FREE_SEEN;
+    ptr_table_free((PTR_TBL_t *)seen);
+}
+
+/* Copy sv for sv_freeze.  New SVs are mortal until they are frozen, so
+ * that a croak part of the way through frees them. */
+
+STATIC SV *
+S_sv_freeze_copy(pTHX_ SV *const sv, PTR_TBL_t *const seen)
+{
+    SV *dsv;
+
+    PERL_ARGS_ASSERT_SV_FREEZE_COPY;
+
+    if (SvFROZEN(sv))
+	return sv;
+    if ((dsv = MUTABLE_SV(ptr_table_fetch(seen, sv))))
+	return dsv;
+    if (SvOBJECT(sv))
+	Perl_croak(aTHX_ "Can't freeze blessed objects");
+
+    switch (SvTYPE(sv)) {
+    case SVt_PVAV: {
+	AV * const av = MUTABLE_AV(sv);
+	AV * const dav = MUTABLE_AV(sv_2mortal(MUTABLE_SV(newAV())));
+	const I32 fill = av_len(av);
+	I32 i;
+
+	ptr_table_store(seen, sv, dav);
+	if (fill >= 0)
+	    av_extend(dav, fill);
+	for (i = 0; i <= fill; i++) {
+	    SV ** const svp = av_fetch(av, i, FALSE);
+	    if (svp)
+		av_store(dav, i, SvREFCNT_inc_simple_NN(
+				      sv_freeze_copy(*svp, seen)));
+	}
+	return MUTABLE_SV(dav);
+    }
+    case SVt_PVHV: {
+	HV * const hv = MUTABLE_HV(sv);
+	HV * const dhv = MUTABLE_HV(sv_2mortal(MUTABLE_SV(newHV())));
+	HE *he;
+
+	ptr_table_store(seen, sv, dhv);
+	/* Shared keys would belong to this interpreter's string table */
+	HvSHAREKEYS_off(dhv);
+	hv_iterinit(hv);
+	while ((he = hv_iternext(hv))) {
+	    SV * const val = sv_freeze_copy(hv_iterval(hv, he), seen);
+	    (void)hv_store_ent(dhv, hv_iterkeysv(he),
+			       SvREFCNT_inc_simple_NN(val), 0);
+	}
+	/* Set up the iterator now, since that reallocates the array */
+	hv_iterinit(dhv);
+	return MUTABLE_SV(dhv);
+    }
+    case SVt_PVCV:
+    case SVt_PVGV:
+    case SVt_PVLV:
+    case SVt_PVFM:
+    case SVt_PVIO:
+	Perl_croak(aTHX_ "Can't freeze %s", sv_reftype(sv, 0));
+    default:
+	break;
+    }
+
+    dsv = sv_2mortal(newSV(0));
+    ptr_table_store(seen, sv, dsv);
+    SvGETMAGIC(sv);
+    if (SvROK(sv)) {
+	SV * const target = sv_freeze_copy(SvRV(sv), seen);
+	SvUPGRADE(dsv, SVt_IV);
+	SvRV_set(dsv, SvREFCNT_inc_simple_NN(target));
+	SvROK_on(dsv);
+    }
+    else {
+	sv_setsv_nomg(dsv, sv);
+	if (SvOK(dsv)) {
+	    /* Cache every conversion now, as other threads mustn't */
+	    SvUPGRADE(dsv, SVt_PVNV);
+	    if (!SvPOKp(dsv))
+		(void)sv_2pv_flags(dsv, NULL, 0);
+	    if (!SvNOKp(dsv))
+		(void)sv_2nv_flags(dsv, 0);
+	    if (!SvIOKp(dsv))
+		(void)sv_2iv_flags(dsv, 0);
+	}
+    }
+    return dsv;
 }
 
 #if defined(USE_ITHREADS)
@@ -10957,8 +11122,20 @@ Perl_rvpv_dup(pTHX_ SV *const dstr, const SV *const sstr, CLONE_PARAMS *const pa
     else if (SvPVX_const(sstr)) {
 	/* Has something there */
 	if (SvLEN(sstr)) {
-	    /* Normal PV - clone whole allocated space */
-	    SvPV_set(dstr, SAVEPVN(SvPVX_const(sstr), SvLEN(sstr)-1));
+	    /* Normal PV - clone whole allocated space, unless it's a plain
+	       string using less than half of it, in which case the new
+	       thread needn't inherit the slack.  Boyer-Moore tables and
+	       compiled formats live past SvCUR, so keep those whole.
+	       Strings that needn't be copied at all can be frozen with
+	       sv_freeze() first; sv_dup_common() shares those instead.  */
+	    STRLEN len = SvLEN(sstr);
+	    if (SvTYPE(sstr) <= SVt_PVMG && SvPOK(sstr) && !SvVALID(sstr)
+		&& SvCUR(sstr) < len / 2
+		&& !(SvMAGICAL(sstr) && mg_find(sstr, PERL_MAGIC_fm))) {
+		len = SvCUR(sstr) + 1;
+		SvLEN_set(dstr, len);
+	    }
+	    SvPV_set(dstr, SAVEPVN(SvPVX_const(sstr), len-1));
 	    if (SvREADONLY(sstr) && SvFAKE(sstr)) {
 		/* Not that normal - actually sstr is copy on write.
 		   But we are a true, independant SV, so:  */
@@ -11024,6 +11201,10 @@ S_sv_dup_common(pTHX_ const SV *const sstr, CLONE_PARAMS *const param)
     if (dstr)
 	return dstr;
 
+    /* Frozen data is shared by all threads */
+    if (SvFROZEN(sstr))
+	return (SV *)sstr;
+
     if(param->flags & CLONEf_JOIN_IN) {
         /** We are joining here so we don't want do clone
 	    something that is bad **/
@@ -12622,6 +12803,9 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
 
     PL_registered_mros  = hv_dup_inc(proto_perl->Iregistered_mros, param);
 
+    /* A new thread starts afresh on frozen hashes */
+    PL_frozen_iters	= NULL;
+
     /* Call the ->CLONE method, if it exists, for each of the stashes
        identified by sv_dup() above.
     */
@@ -278,6 +278,15 @@ perform the upgrade if necessary.  See C<svtype>.
 #define SvREFCNT_dec(sv)	sv_free(MUTABLE_SV(sv))
 #endif
 
+/* Frozen SVs (see sv_freeze) are shared between threads, which update
+ * their reference counts without locking, and are only freed by global
+ * destruction.  Their counts start so high that lost updates can never
+ * bring them near 0.  The immortals also have high counts, so they are
+ * excluded by address. */
+#define SV_FROZEN_REFCNT	((U32)0xE0000000)
+#define SvFROZEN(sv)		(SvREFCNT(sv) >= (U32)0xC0000000 \
+				 && !SvIMMORTAL(sv))
+
 #define SVTYPEMASK	0xff
 #define SvTYPE(sv)	((svtype)((sv)->sv_flags & SVTYPEMASK))
 
@@ -0,0 +1,135 @@
+#!./perl
+
+BEGIN {
+    chdir 't' if -d 't';
+    @INC = '../lib';
+    require './test.pl';
+    require Config; import Config;
+    unless ($Config{useperlio}) {
+	skip_all("PerlIO not used");
+    }
+}
+
+plan tests => 28;
+
+my $src = tempfile();
+my $dst = tempfile();
+
+my $data = join '', map { sprintf "line %06d %s\n", $_, 'x' x ($_ % 70) }
+    1 .. 20000;
+open my $fh, '>:raw', $src or die "Can't open $src: $!";
+print $fh $data;
+close $fh or die "Can't close $src: $!";
+
+sub slurp {
+    my ($file) = @_;
+    open my $in, '<:raw', $file or die "Can't open $file: $!";
+    local $/;
+    my $got = <$in>;
+    close $in;
+    return $got;
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '>', $dst or die "Can't open $dst: $!";
+    is(PerlIO::copy($in, $out), length $data, 'copy whole file');
+    is(tell($in), length $data, 'input position follows the copy');
+    is(tell($out), length $data, 'output position follows the copy');
+    ok(eof($in), 'input at end of file');
+    close $out;
+    ok(slurp($dst) eq $data, 'copied data matches');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '>', $dst or die "Can't open $dst: $!";
+    my $first = <$in>;
+    is(PerlIO::copy($in, $out, 1000), 1000, 'copy with a length');
+    print $out "--";
+    is(PerlIO::copy($in, $out, undef), length($data) - length($first) - 1000,
+       'copy the rest');
+    close $out;
+    ok(slurp($dst) eq substr($data, length $first, 1000) . '--'
+       . substr($data, length($first) + 1000),
+       'buffered input is written first, in order');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '>', $dst or die "Can't open $dst: $!";
+    print $out "head\n";
+    is(PerlIO::copy($in, $out, 10), 10, 'copy after buffered output');
+    print $out "tail\n";
+    close $out;
+    is(slurp($dst), "head\n" . substr($data, 0, 10) . "tail\n",
+       'buffered output is written first');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '>:crlf', $dst or die "Can't open $dst: $!";
+    is(PerlIO::copy($in, $out), length $data, 'copy through :crlf');
+    close $out;
+    (my $want = $data) =~ s/\n/\r\n/g;
+    ok(slurp($dst) eq $want, 'data went through the layer');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    my $mem = '';
+    open my $out, '>', \$mem or die "Can't open in-memory handle: $!";
+    is(PerlIO::copy($in, $out), length $data, 'copy to an in-memory handle');
+    close $out;
+    ok($mem eq $data, 'in-memory copy matches');
+
+    open $in, '<', \$mem or die "Can't open in-memory handle: $!";
+    open $out, '>', $dst or die "Can't open $dst: $!";
+    is(PerlIO::copy($in, $out), length $data, 'copy from an in-memory handle');
+    close $out;
+    ok(slurp($dst) eq $data, 'copy from memory matches');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '>>', $dst or die "Can't open $dst: $!";
+    is(PerlIO::copy($in, $out, 5), 5, 'copy to a file opened for append');
+    close $out;
+    is(length slurp($dst), length($data) + 5, 'appended');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    seek $in, 0, 2;
+    open my $out, '>', $dst or die "Can't open $dst: $!";
+    is(PerlIO::copy($in, $out), 0, 'nothing to copy at end of file');
+    close $out;
+    is(-s $dst, 0, 'nothing written');
+}
+
+{
+    open my $in, '<', $src or die "Can't open $src: $!";
+    open my $out, '<', $src or die "Can't open $src: $!";
+    close $out;
+    is(PerlIO::copy($in, $out), undef, 'copy to a closed handle fails');
+    ok($!, '... and sets $!');
+}
+
+SKIP: {
+    skip("no fork", 6) unless $Config{d_fork};
+    require IO::Handle;
+    local $SIG{PIPE} = 'IGNORE';
+    # The reader goes away after a little of the data, so the copy fails
+    # part way through, once the pipe buffer is full
+    for my $layer (':raw', ':crlf') {
+	open my $in, '<', $src or die "Can't open $src: $!";
+	open my $out, '|-', $^X, '-e', 'read STDIN, my $x, 1000'
+	    or die "Can't start reader: $!";
+	binmode $out, $layer;
+	is(PerlIO::copy($in, $out), undef, "a copy that fails part way fails ($layer)");
+	ok($!, '... and sets $!');
+	ok($out->error, '... and flags the handle');
+	close $out;
+    }
+}
+
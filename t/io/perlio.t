@@ -9,7 +9,7 @@ BEGIN {
 	require './test.pl';
 }
 
-plan tests => 42;
+plan tests => 54;
 
 use_ok('PerlIO');
 
@@ -197,6 +197,45 @@ close ($no_perlio);
 }
 
 
+{
+    # print LIST hands runs of plain strings to the layers as a gather
+    # write; check the bytes still come out in order whatever the layer
+    package Stringy;
+    use overload '""' => sub { ${$_[0]} };
+    package main;
+
+    my $head = "HTTP/1.0 200 OK\r\n\r\n";
+    my $body = join '', map { chr(65 + $_ % 26) x 1000 } 1 .. 300;
+    my $obj  = bless \(my $s = "<obj>"), 'Stringy';
+    for my $layer (':perlio', ':unix', ':crlf', ':raw:perlio') {
+	ok(open(my $fh, ">$layer", $bin), "open $layer for gathered print");
+	print $fh "small";
+	print $fh $head, $body, 42, $obj, $body, "tail\n";
+	{
+	    local $, = '|';
+	    print $fh "a", $body, "b";
+	}
+	close $fh;
+	open $fh, '<:raw', $bin or die "cannot read $bin: $!";
+	my $got = do { local $/; <$fh> };
+	close $fh;
+	my $want = "small$head${body}42<obj>${body}tail\n" . "a|$body|b";
+	$want =~ s/\n/\r\n/g if $layer eq ':crlf';
+	ok($got eq $want, "gathered print through $layer");
+    }
+
+    SKIP: {
+	skip("no /dev/full", 4) unless -c '/dev/full';
+	# A gather write that can't be written at all must fail, not spin
+	for my $layer (':perlio', ':unix') {
+	    open(my $fh, ">$layer", '/dev/full') or die "/dev/full: $!";
+	    ok(!print($fh $head, $body), "gathered print to a full device fails ($layer)");
+	    ok(!close($fh), '... and so does close');
+	}
+    }
+}
+
+
 END {
     1 while unlink $txt;
     1 while unlink $bin;
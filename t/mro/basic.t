@@ -3,7 +3,7 @@
 use strict;
 use warnings;
 
-require q(./test.pl); plan(tests => 48);
+require q(./test.pl); plan(tests => 50);
 
 require mro;
 
@@ -287,3 +287,20 @@ is(eval { MRO_N->testfunc() }, 123);
     };
     is($@, "");
 }
+
+{
+    # c3 copies the names from the parents' linearizations, including
+    # those of parents without a stash
+    package MRO_Chain1;
+    our @ISA = ('MRO_NoStash');
+    package MRO_Chain2;
+    our @ISA = ('MRO_Chain1');
+    package MRO_Chain3;
+    our @ISA = ('MRO_Chain2', 'MRO_C');
+    package main;
+    mro::set_mro($_, 'c3') foreach qw/MRO_Chain1 MRO_Chain2 MRO_Chain3/;
+    ok(eq_array(mro::get_linear_isa('MRO_Chain3'),
+                [qw/MRO_Chain3 MRO_Chain2 MRO_Chain1 MRO_NoStash MRO_C/]));
+    my %seen = map { $_ => 1 } @{mro::get_linear_isa('MRO_Chain2')};
+    ok(eq_array([sort keys %seen], [qw/MRO_Chain1 MRO_Chain2 MRO_NoStash/]));
+}
@@ -4,6 +4,7 @@ use strict;
 use warnings;
 no warnings 'redefine'; # we do a lot of this
 no warnings 'prototype'; # we do a lot of this
+no warnings 'once';
 
 BEGIN {
     unless (-d 'blib') {
@@ -22,8 +23,22 @@ require './test.pl';
     our @ISA = qw/MCTest::Base/;
 
     package Foo; our @FOO = qw//;
+
+    package MCTest::Top;
+    sub bar { 'Top' }
+    sub other { 'other' }
+
+    package MCTest::Mid;
+    our @ISA = qw/MCTest::Top/;
+
+    package MCTest::Leaf;
+    our @ISA = qw/MCTest::Mid/;
 }
 
+# One call site, so that its inline cache is exercised too
+sub call { my $meth = shift; MCTest::Leaf->$meth() }
+sub call_bar { MCTest::Leaf->bar() }
+
 # These are various ways of re-defining MCTest::Base::foo and checking whether the method is cached when it shouldn't be
 my @testsubs = (
     sub { is(MCTest::Derived->foo(0), 1); },
@@ -57,6 +72,27 @@ my @testsubs = (
     sub { *{MCTest::Base::} = *{Foo::}; eval { MCTest::Derived->foo(0) }; like($@, qr/locate object method/); },
     sub { *MCTest::Derived::foo = \&MCTest::Base::foo; eval { MCTest::Derived::foo(0,0) }; ok(!$@); undef *MCTest::Derived::foo },
     sub { eval 'package MCTest::Base; sub foo { $_[1]+18 }'; is(MCTest::Derived->foo(0), 18); },
+
+    # Installing one method only drops what was cached under its name
+    sub { is(call_bar() . MCTest::Leaf->other(), 'Topother'); },
+    sub { eval 'sub MCTest::Mid::bar { "Mid" }'; is(call_bar(), 'Mid'); },
+    sub { *MCTest::Top::bar = sub { 'Top2' }; is(call_bar(), 'Mid'); },
+    sub { undef *MCTest::Mid::bar; is(call_bar() . MCTest::Leaf->other(), 'Top2other'); },
+    sub { ok(!MCTest::Leaf->can('baz')); },
+    sub { *MCTest::Top::baz = sub { 'baz' }; is(call('baz'), 'baz'); },
+    sub { *MCTest::Mid::baz = sub { 'Mid baz' }; is(call('baz'), 'Mid baz'); },
+    sub { undef *MCTest::Mid::baz; is(call('baz'), 'baz'); },
+    # ... except when the glob is shared with other names
+    sub { *MCTest::Top::qux = *MCTest::Top::bar; is(call('qux'), 'Top2'); },
+    sub { eval 'sub MCTest::Top::bar { "Top3" }'; is(call('qux') . call_bar(), 'Top3Top3'); },
+    # ... and for what the overload tables depend on
+    sub { my $obj = bless [], 'MCTest::Leaf'; my $x = "$obj";
+          my $destroyed; *MCTest::Top::DESTROY = sub { $destroyed++ };
+          undef $obj; ok($destroyed); },
+    sub { eval 'package MCTest::Top; use overload q{+} => "plus"; sub plus { 42 }';
+          my $obj = bless [], 'MCTest::Leaf'; my $x = $obj + 1;
+          eval 'sub MCTest::Mid::plus { 43 }';
+          is(bless([], 'MCTest::Leaf') + 1, 43); },
 );
 
 plan(tests => scalar(@testsubs));
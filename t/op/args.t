@@ -6,7 +6,7 @@ BEGIN {
 }
 
 require './test.pl';
-plan( tests => 23 );
+plan( tests => 31 );
 
 # test various operations on @_
 
@@ -104,4 +104,38 @@ for (1..3) {
     ok($flag, 'delete $_[0] : outside block');
 }
 
-	
+# my (...) = @_ is done by the aassign alone
+
+{
+    sub unpack3 {
+	my ($x, $y, $z) = @_;
+	join ',', map { defined $_ ? $_ : 'u' } $x, $y, $z;
+    }
+    is(unpack3(1, 2, 3), '1,2,3', 'my (...) = @_');
+    is(unpack3(1), '1,u,u', '... with fewer arguments');
+    is(unpack3(1 .. 5), '1,2,3', '... with more arguments');
+    my @holes;
+    $holes[2] = 3;
+    is(unpack3(@holes), 'u,u,3', '... with nonexistent elements');
+
+    sub copies { my ($x) = @_; $x .= '!'; $x }
+    my $v = 'a';
+    is(copies($v) . $v, 'a!a', '... copies the arguments');
+
+    sub fact { my ($n) = @_; $n > 1 ? $n * fact($n - 1) : 1 }
+    is(fact(6), 720, '... in recursion');
+
+    sub closure { my ($x) = @_; sub { $x } }
+    my @subs = map { closure($_) } 1 .. 3;
+    is(join(',', map { $_->() } @subs), '1,2,3', '... with closures');
+
+    {
+	package Args::Tied;
+	sub TIEARRAY { bless [] }
+	sub FETCHSIZE { 2 }
+	sub FETCH { $_[0][$_[1]]++; "f$_[1]" }
+    }
+    my $obj = tie my @tied, 'Args::Tied';
+    sub tied_args { local *_ = \@tied; my ($x, $y, $z) = @_; "$x$y" . (defined $z ? 'd' : 'u') }
+    is(tied_args() . ":@$obj", 'f0f1u:1 1', '... with tied @_');
+}
@@ -10,7 +10,7 @@ BEGIN {
     require "test.pl";
 }
 
-print "1..79\n";
+print "1..89\n";
 
 @A::ISA = 'B';
 @B::ISA = 'C';
@@ -305,3 +305,55 @@ EOT
     );
 }
 
+
+# The same call site on objects of several classes, with the method
+# changing under it; each call must see the current definition.
+{
+    package MC::Base; sub new { bless [], $_[0] } sub who { "base" }
+    package MC::A; our @ISA = 'MC::Base';
+    package MC::B; our @ISA = 'MC::Base'; sub who { "b" }
+    package MC::C; our @ISA = 'MC::Base';
+    package MC::D; our @ISA = 'MC::Base';
+    package MC::E; our @ISA = 'MC::Base';
+    package MC::Other; sub who { "other" }
+    package main;
+
+    my @objs = map { $_->new } qw(MC::A MC::B MC::C MC::D MC::E);
+    my $call = sub { join ",", map { $_->who } @objs };
+
+    is($call->(), "base,b,base,base,base", "call site with five classes");
+    is($call->(), "base,b,base,base,base", "... again, from the cache");
+
+    no warnings 'redefine';
+    *MC::Base::who = sub { "new base" };
+    is($call->(), "new base,b,new base,new base,new base",
+       "inherited method redefined");
+
+    *MC::C::who = sub { "c" };
+    is($call->(), "new base,b,c,new base,new base", "method added to a class");
+
+    @MC::D::ISA = 'MC::Other';
+    is($call->(), "new base,b,c,other,new base", "\@ISA changed");
+
+    {
+	local *MC::B::who = sub { "local b" };
+	is($call->(), "new base,local b,c,other,new base", "local *method");
+    }
+    is($call->(), "new base,b,c,other,new base", "... restored");
+
+    delete $MC::C::{who};
+    is($call->(), "new base,b,new base,other,new base", "method deleted");
+
+    sub UNIVERSAL::who { "universal" }
+    undef *MC::Base::who;
+    is($call->(), "universal,b,universal,other,universal",
+       "method removed, found in UNIVERSAL");
+
+    my @seen;
+    sub MC::Auto::AUTOLOAD { push @seen, $MC::Auto::AUTOLOAD; "auto" }
+    my $auto = bless [], 'MC::Auto';
+    $auto->what for 1..2;
+    $auto->when;
+    is("@seen", "MC::Auto::what MC::Auto::what MC::Auto::when",
+       "AUTOLOAD sees every call");
+}
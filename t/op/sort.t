@@ -6,7 +6,7 @@ BEGIN {
     require 'test.pl';
 }
 use warnings;
-plan( tests => 151 );
+plan( tests => 163 );
 
 # these shouldn't hang
 {
@@ -843,3 +843,45 @@ is("@b", "1 2 3 3 4 5 7", "comparison result as string");
     is("@sorted","1 2", 'overload sort result');
     is($cs, 2, 'overload string called twice');
 }
+
+# Long lists of plain numbers and strings are sorted by key extraction;
+# the result must match the ordinary comparison sort, stability included.
+
+{
+    my $n = 2000;
+    my @iv = map { int(rand(2e6)) - 1e6 } 1 .. $n;
+    push @iv, ~0 >> 1, -(~0 >> 1) - 1, 0, -1;
+    my @nv = map { (rand(2) - 1) * 10 ** int(rand(20) - 10) } 1 .. $n;
+    push @nv, 9**9**9, -9**9**9, 0, -0.0, 1e-300, -1e-300;
+    # Numerically equal but distinguishable, to check stability
+    my @mixed = map { ("0" x ($_ % 3)) . int(rand(100)) } 1 .. $n;
+    push @mixed, 1.5, 2 ** 60, 2 ** 60 + 1, -3;
+    my @str = map { join '', map { chr(97 + rand 3) } 0 .. rand 12 } 1 .. $n;
+    push @str, '', "\0", "a\0", "a", "aaaaaaaa", "aaaaaaaa\0", "aaaaaaaab";
+    my @utf8 = map { join '', map { chr(0x100 + rand 300) } 0 .. rand 10 } 1 .. $n;
+
+    for ([\@iv, 'integers'], [\@nv, 'floats'], [\@mixed, 'mixed numbers']) {
+	my ($list, $name) = @$_;
+	my @want = sort { ($a <=> $b) || 0 } @$list;
+	is("@{[sort { $a <=> $b } @$list]}", "@want", "key sort of $name");
+	@want = sort { ($b <=> $a) || 0 } @$list;
+	is("@{[sort { $b <=> $a } @$list]}", "@want",
+	   "descending key sort of $name");
+    }
+    {
+	use integer;
+	my @want = sort { ($a <=> $b) || 0 } @iv;
+	is("@{[sort { $a <=> $b } @iv]}", "@want", 'key sort under integer');
+    }
+    for ([\@str, 'strings'], [\@utf8, 'UTF-8 strings']) {
+	my ($list, $name) = @$_;
+	my @want = sort { ($a cmp $b) || 0 } @$list;
+	is(join(",", sort @$list), join(",", @want), "key sort of $name");
+	@want = sort { ($b cmp $a) || 0 } @$list;
+	is(join(",", sort { $b cmp $a } @$list), join(",", @want),
+	   "descending key sort of $name");
+    }
+    my @nan = (@nv, 9**9**9 / 9**9**9);
+    my @want = sort { ($a <=> $b) || 0 } @nan;
+    is("@{[sort { $a <=> $b } @nan]}", "@want", 'NaN falls back');
+}
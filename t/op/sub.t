@@ -6,7 +6,7 @@ BEGIN {
     require './test.pl';
 }
 
-plan( tests => 4 );
+plan( tests => 22 );
 
 sub empty_sub {}
 
@@ -17,3 +17,54 @@ is(scalar(@test), 0, 'Didnt return anything');
 @test = empty_sub(1,2,3);
 is(scalar(@test), 0, 'Didnt return anything');
 
+
+# Small subs with $ prototypes are inlined, but redefining them must still
+# take effect.
+sub inl_add ($$) { $_[0] + $_[1] }
+sub inl_name ($) { $_[0]{name} }
+sub inl_neg ($) { return -$_[0] }
+
+my ($x, $y, $obj) = (3, 4, { name => 'bob' });
+is(inl_add($x, $y), 7, 'inlined sub');
+is(inl_add($x, 1), 4, 'inlined sub with a constant argument');
+is(inl_name($obj), 'bob', 'inlined accessor');
+is(inl_neg($x), -3, 'inlined sub with return');
+
+sub call_inl_add { inl_add($x, $y) }
+{
+    no warnings 'redefine';
+    *inl_add = sub ($$) { $_[0] * $_[1] };
+    is(call_inl_add(), 12, 'glob assignment replaces an inlined sub');
+    eval 'sub inl_add ($$) { $_[0] - $_[1] }';
+    is(call_inl_add(), -1, 'so does a new definition');
+    undef &inl_add;
+    ok(!eval { call_inl_add(); 1 }, 'undefined inlined sub dies');
+    like($@, qr/^Undefined subroutine &main::inl_add called/,
+	 '... as a call would');
+    eval 'sub inl_add ($$) { $_[0] . $_[1] }';
+    is(call_inl_add(), 34, 'defining it again after undef');
+}
+
+# The result is a copy, as the sub would return
+$_ .= '!' for inl_name($obj);
+is($obj->{name}, 'bob', 'result of an inlined accessor is not aliased');
+my $ref = \inl_name($obj);
+$$ref = 'x';
+is($obj->{name}, 'bob', '... nor referenced');
+
+# Arguments are aliased as in @_
+my $undef;
+is(inl_name($undef), undef, 'inlined accessor on undef');
+is(ref $undef, 'HASH', '... vivifies the argument as the sub would');
+is(inl_add($x, $x), 33, 'argument used twice');
+
+# Errors and warnings from an inlined body name the sub's line, and the
+# caller's line again after it
+sub inl_div ($$) { $_[0] / $_[1] }
+my $inl_line = __LINE__ - 1;
+my $zero = 0;
+ok(!eval { my $r = inl_div($x, $zero); 1 }, 'inlined division by zero dies');
+like($@, qr/^Illegal division by zero at \S+ line $inl_line\.$/,
+     '... at the line of the sub');
+ok(!eval { my $r = inl_add($x, $x) / $zero; 1 }, 'division after an inlined sub');
+like($@, qr/ line ${\(__LINE__ - 1)}\.$/, '... dies at the caller\'s line');
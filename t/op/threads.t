@@ -16,7 +16,7 @@ BEGIN {
        exit 0;
      }
 
-     plan(23);
+     plan(24);
 }
 
 use strict;
@@ -349,4 +349,16 @@ threads->create(
 
 EOI
 
+# A string using little of its buffer is cloned without the slack
+{
+    my $str = "x" x 100_000;
+    $str = "short";
+    my $got = threads->create(sub {
+        my $before = $str;
+        $str .= "er" x 10;
+        "$before:" . length($str) . ":" . substr($str, 0, 7);
+    })->join;
+    is($got, "short:25:shorter", 'cloned string keeps its value and grows');
+}
+
 # EOF
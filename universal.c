@@ -975,6 +975,43 @@ XS(XS_PerlIO_get_layers)
     XSRETURN(0);
 }
 
+XS(XS_PerlIO_copy)
+{
+    dVAR;
+    dXSARGS;
+    if (items < 2 || items > 3)
+	croak_xs_usage(cv, "from, to[, length]");
+#ifdef USE_PERLIO
+    {
+	IO * const from = sv_2io(ST(0));
+	IO * const to = sv_2io(ST(1));
+#if LSEEKSIZE > IVSIZE
+	const Off_t count = (items > 2 && SvOK(ST(2))) ? (Off_t)SvNV(ST(2)) : -1;
+#else
+	const Off_t count = (items > 2 && SvOK(ST(2))) ? (Off_t)SvIV(ST(2)) : -1;
+#endif
+	Off_t copied;
+
+	if (!IoIFP(from) || !IoOFP(to)) {
+	    SETERRNO(EBADF, RMS_IFI);
+	    XSRETURN_UNDEF;
+	}
+	copied = PerlIO_copy(IoIFP(from), IoOFP(to), count);
+	if (copied < 0)
+	    XSRETURN_UNDEF;
+#if LSEEKSIZE > IVSIZE
+	ST(0) = sv_2mortal(newSVnv((NV)copied));
+#else
+	ST(0) = sv_2mortal(newSViv((IV)copied));
+#endif
+	XSRETURN(1);
+    }
+#else
+    SETERRNO(EINVAL, LIB_INVARG);
+    XSRETURN_UNDEF;
+#endif
+}
+
 XS(XS_Internals_hash_seed)
 {
     dVAR;
@@ -1513,6 +1550,7 @@ struct xsub_details details[] = {
     {"Internals::SvREFCNT", XS_Internals_SvREFCNT, "\\[$%@];$"},
     {"Internals::hv_clear_placeholders", XS_Internals_hv_clear_placehold, "\\%"},
     {"PerlIO::get_layers", XS_PerlIO_get_layers, "*;@"},
+    {"PerlIO::copy", XS_PerlIO_copy, "**;$"},
     {"Internals::hash_seed", XS_Internals_hash_seed, ""},
     {"Internals::rehash_seed", XS_Internals_rehash_seed, ""},
     {"Internals::HvREHASH", XS_Internals_HvREHASH, "\\%"},
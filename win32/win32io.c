@@ -377,6 +377,7 @@ PERLIO_FUNCS_DECL(PerlIO_win32) = {
  NULL, /* get_ptr */
  NULL, /* get_cnt */
  NULL, /* set_ptrcnt */
+ NULL, /* writev */
 };
 
 #endif